@@ -0,0 +1,112 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef URI_BENCHMARK_URLS_INC
+#define URI_BENCHMARK_URLS_INC
+
+#include <cstddef>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace benchmark_urls {
+// Loads a URL list in the same format as the test lists: one URL
+// per line, lines beginning with '#' are ignored.
+inline std::vector<std::string> load(const std::string &name) {
+  const std::string filename = std::string(URI_BENCHMARK_DATA_DIR) + "/" + name;
+  std::ifstream ifs(filename);
+  if (!ifs) {
+    throw std::runtime_error("Unable to open file: " + filename);
+  }
+
+  std::vector<std::string> urls;
+  for (std::string url; std::getline(ifs, url);) {
+    if (!url.empty() && url.front() != '#') {
+      urls.push_back(url);
+    }
+  }
+  return urls;
+}
+
+inline const std::vector<std::string> &valid_urls() {
+  static const std::vector<std::string> urls = load("valid_urls.txt");
+  return urls;
+}
+
+// Crawler-style URLs, around 180 bytes long, most of which is a
+// query string.
+inline const std::vector<std::string> &long_query_urls() {
+  static const std::vector<std::string> urls = [] {
+    std::vector<std::string> urls;
+    for (int i = 0; i < 32; ++i) {
+      const auto n = std::to_string(i);
+      urls.push_back("https://www.example" + n +
+                     ".com/catalog/products/item-" + n +
+                     "/details?utm_source=newsletter&utm_medium=email"
+                     "&utm_campaign=autumn_sale_2026&session=a1b2c3d4e5f6" +
+                     n + "&ref=%2Fhome%2Findex.html&lang=en-GB&page=" + n);
+    }
+    return urls;
+  }();
+  return urls;
+}
+
+// URLs with an IPv6 host and a port.
+inline const std::vector<std::string> &ipv6_urls() {
+  static const std::vector<std::string> urls = [] {
+    std::vector<std::string> urls;
+    for (int i = 0; i < 32; ++i) {
+      const auto n = std::to_string(i);
+      urls.push_back("http://[2001:db8:85a3::8a2e:370:" + n + "]:8080/api/v" +
+                     n + "/status?verbose=" + n);
+    }
+    return urls;
+  }();
+  return urls;
+}
+
+// URLs with a long path of short segments, some of which are dot
+// segments, and a few percent encoded characters.
+inline const std::vector<std::string> &deep_path_urls() {
+  static const std::vector<std::string> urls = [] {
+    std::vector<std::string> urls;
+    for (int i = 0; i < 32; ++i) {
+      const auto n = std::to_string(i);
+      std::string url("https://cdn.example.com");
+      for (int segment = 0; segment < 24; ++segment) {
+        url += (segment % 8 == 3) ? "/./" : (segment % 8 == 6) ? "/../" : "/";
+        url += "seg%2D" + std::to_string(segment) + "-" + n;
+      }
+      urls.push_back(url + "/index.html");
+    }
+    return urls;
+  }();
+  return urls;
+}
+
+// All of the above.
+inline const std::vector<std::string> &all_urls() {
+  static const std::vector<std::string> urls = [] {
+    std::vector<std::string> urls;
+    for (const auto *corpus : {&valid_urls(), &long_query_urls(), &ipv6_urls(),
+                               &deep_path_urls()}) {
+      urls.insert(std::end(urls), std::begin(*corpus), std::end(*corpus));
+    }
+    return urls;
+  }();
+  return urls;
+}
+
+inline std::size_t total_bytes(const std::vector<std::string> &urls) {
+  std::size_t bytes = 0;
+  for (const auto &url : urls) {
+    bytes += url.size();
+  }
+  return bytes;
+}
+}  // namespace benchmark_urls
+
+#endif  // URI_BENCHMARK_URLS_INC
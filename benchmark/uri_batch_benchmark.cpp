@@ -0,0 +1,70 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <network/uri.hpp>
+#include "benchmark_urls.hpp"
+
+namespace {
+// A frontier-style buffer of around 16 MB of newline separated URLs.
+const std::string &frontier() {
+  static const std::string buffer = [] {
+    std::string buffer;
+    while (buffer.size() < (16u << 20)) {
+      for (const auto &url : benchmark_urls::valid_urls()) {
+        buffer += url;
+        buffer += '\n';
+      }
+      for (const auto &url : benchmark_urls::long_query_urls()) {
+        buffer += url;
+        buffer += '\n';
+      }
+    }
+    return buffer;
+  }();
+  return buffer;
+}
+}  // namespace
+
+static void parse_batch_frontier(benchmark::State &state) {
+  const auto &buffer = frontier();
+  std::size_t lines = 0;
+  for (auto _ : state) {
+    auto batch =
+        network::parse_batch(buffer, static_cast<unsigned>(state.range(0)));
+    lines = batch.size();
+    benchmark::DoNotOptimize(batch);
+  }
+  state.SetBytesProcessed(state.iterations() * buffer.size());
+  state.SetItemsProcessed(state.iterations() * lines);
+}
+BENCHMARK(parse_batch_frontier)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+static void construct_uri_frontier(benchmark::State &state) {
+  const auto &buffer = frontier();
+  std::size_t lines = 0;
+  for (auto _ : state) {
+    lines = 0;
+    auto first = std::begin(buffer), last = std::end(buffer);
+    while (first != last) {
+      auto newline = std::find(first, last, '\n');
+      std::error_code ec;
+      network::uri instance(std::string(first, newline), ec);
+      benchmark::DoNotOptimize(instance);
+      first = (newline == last) ? last : newline + 1;
+      ++lines;
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * buffer.size());
+  state.SetItemsProcessed(state.iterations() * lines);
+}
+BENCHMARK(construct_uri_frontier)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,418 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <network/uri.hpp>
+#include "benchmark_urls.hpp"
+
+namespace {
+typedef std::string::const_iterator input_iterator;
+typedef std::back_insert_iterator<std::string> output_iterator;
+
+// Every URL in the corpora that can be parsed and normalized.
+const std::vector<network::uri> &corpus() {
+  static const std::vector<network::uri> uris = [] {
+    std::vector<network::uri> uris;
+    for (const auto &url : benchmark_urls::all_urls()) {
+      std::error_code ec;
+      network::uri instance(url, ec);
+      if (ec) {
+        continue;
+      }
+
+      try {
+        instance.normalize(network::uri_comparison_level::syntax_based);
+        uris.push_back(instance);
+      } catch (const std::exception &) {
+      }
+    }
+    return uris;
+  }();
+  return uris;
+}
+
+// The URLs in the corpus with an authority, which is what resolve,
+// make_relative and the uri_builder need.
+const std::vector<network::uri> &hierarchical_corpus() {
+  static const std::vector<network::uri> uris = [] {
+    std::vector<network::uri> uris;
+    for (const auto &instance : corpus()) {
+      if (instance.has_authority()) {
+        uris.push_back(instance);
+      }
+    }
+    return uris;
+  }();
+  return uris;
+}
+
+std::size_t total_bytes(const std::vector<network::uri> &uris) {
+  std::size_t bytes = 0;
+  for (const auto &instance : uris) {
+    bytes += instance.string().size();
+  }
+  return bytes;
+}
+
+template <class Operation>
+void run_operation(benchmark::State &state,
+                   const std::vector<network::uri> &uris,
+                   Operation operation) {
+  for (auto _ : state) {
+    for (const auto &instance : uris) {
+      benchmark::DoNotOptimize(operation(instance));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * total_bytes(uris));
+  state.SetItemsProcessed(state.iterations() * uris.size());
+}
+
+template <class Encode>
+void run_encode(benchmark::State &state, const std::vector<std::string> &input,
+                Encode encode) {
+  std::string output;
+  for (auto _ : state) {
+    for (const auto &value : input) {
+      output.clear();
+      encode(std::begin(value), std::end(value), std::back_inserter(output));
+      benchmark::DoNotOptimize(output.data());
+    }
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          benchmark_urls::total_bytes(input));
+  state.SetItemsProcessed(state.iterations() * input.size());
+}
+}  // namespace
+
+static void accessor(benchmark::State &state,
+                     network::string_view (network::uri::*get)() const) {
+  run_operation(state, corpus(), [get](const network::uri &instance) {
+    return (instance.*get)();
+  });
+}
+BENCHMARK_CAPTURE(accessor, scheme, &network::uri::scheme);
+BENCHMARK_CAPTURE(accessor, user_info, &network::uri::user_info);
+BENCHMARK_CAPTURE(accessor, host, &network::uri::host);
+BENCHMARK_CAPTURE(accessor, port, &network::uri::port);
+BENCHMARK_CAPTURE(accessor, path, &network::uri::path);
+BENCHMARK_CAPTURE(accessor, query, &network::uri::query);
+BENCHMARK_CAPTURE(accessor, fragment, &network::uri::fragment);
+BENCHMARK_CAPTURE(accessor, authority, &network::uri::authority);
+
+static void normalize(benchmark::State &state) {
+  run_operation(state, corpus(), [](const network::uri &instance) {
+    return instance.normalize(network::uri_comparison_level::syntax_based);
+  });
+}
+BENCHMARK(normalize);
+
+static void normalize_in_place(benchmark::State &state) {
+  const auto &uris = corpus();
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto copies = uris;
+    state.ResumeTiming();
+    for (auto &instance : copies) {
+      instance.normalize_in_place(network::uri_comparison_level::syntax_based);
+      benchmark::DoNotOptimize(instance);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * total_bytes(uris));
+  state.SetItemsProcessed(state.iterations() * uris.size());
+}
+BENCHMARK(normalize_in_place);
+
+static void normalize_scheme_based(benchmark::State &state) {
+  run_operation(state, corpus(), [](const network::uri &instance) {
+    return instance.normalize(network::uri_comparison_level::scheme_based);
+  });
+}
+BENCHMARK(normalize_scheme_based);
+
+static void hash_scheme_based(benchmark::State &state) {
+  run_operation(state, corpus(), [](const network::uri &instance) {
+    return instance.hash(network::uri_comparison_level::scheme_based);
+  });
+}
+BENCHMARK(hash_scheme_based);
+
+static void compare(benchmark::State &state) {
+  static const std::vector<network::uri> normalized = [] {
+    std::vector<network::uri> uris;
+    for (const auto &instance : corpus()) {
+      uris.push_back(
+          instance.normalize(network::uri_comparison_level::syntax_based));
+    }
+    return uris;
+  }();
+
+  const auto &uris = corpus();
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < uris.size(); ++i) {
+      benchmark::DoNotOptimize(uris[i].compare(
+          normalized[i], network::uri_comparison_level::syntax_based));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * total_bytes(uris));
+  state.SetItemsProcessed(state.iterations() * uris.size());
+}
+BENCHMARK(compare);
+
+// Sorts the corpus at the syntax_based level, where most comparisons
+// stop at the first difference.
+static void sort_syntax_based(benchmark::State &state) {
+  const auto level = network::uri_comparison_level::syntax_based;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto uris = corpus();
+    state.ResumeTiming();
+    std::sort(std::begin(uris), std::end(uris),
+              [level](const network::uri &lhs, const network::uri &rhs) {
+                return lhs.compare(rhs, level) < 0;
+              });
+    benchmark::DoNotOptimize(uris.data());
+  }
+  state.SetItemsProcessed(state.iterations() * corpus().size());
+}
+BENCHMARK(sort_syntax_based);
+
+namespace {
+const std::vector<network::cached_uri> &cached_corpus() {
+  static const std::vector<network::cached_uri> uris(std::begin(corpus()),
+                                                     std::end(corpus()));
+  return uris;
+}
+}  // namespace
+
+// Normalizes URIs that have been normalized before.
+static void normalize_cached(benchmark::State &state) {
+  const auto &uris = cached_corpus();
+  for (auto _ : state) {
+    for (const auto &instance : uris) {
+      benchmark::DoNotOptimize(
+          &instance.normalize(network::uri_comparison_level::syntax_based));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * total_bytes(corpus()));
+  state.SetItemsProcessed(state.iterations() * uris.size());
+}
+BENCHMARK(normalize_cached);
+
+static void sort_syntax_based_cached(benchmark::State &state) {
+  const auto level = network::uri_comparison_level::syntax_based;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto uris = cached_corpus();
+    for (const auto &instance : uris) {
+      instance.normalize(level);
+    }
+    state.ResumeTiming();
+    std::sort(std::begin(uris), std::end(uris),
+              [level](const network::cached_uri &lhs,
+                      const network::cached_uri &rhs) {
+                return lhs.compare(rhs, level) < 0;
+              });
+    benchmark::DoNotOptimize(uris.data());
+  }
+  state.SetItemsProcessed(state.iterations() * corpus().size());
+}
+BENCHMARK(sort_syntax_based_cached);
+
+static void resolve(benchmark::State &state) {
+  static const network::uri reference = network::uri_builder()
+                                            .path("../sibling/./index.html")
+                                            .append_query_key_value_pair("q", "1")
+                                            .uri();
+  run_operation(state, hierarchical_corpus(),
+                [](const network::uri &base) { return reference.resolve(base); });
+}
+BENCHMARK(resolve);
+
+static void make_relative(benchmark::State &state) {
+  static const std::vector<network::uri> bases = [] {
+    std::vector<network::uri> uris;
+    for (const auto &instance : hierarchical_corpus()) {
+      uris.push_back(network::uri(instance.scheme().to_string() + "://" +
+                                  instance.authority().to_string() + "/"));
+    }
+    return uris;
+  }();
+
+  const auto &uris = hierarchical_corpus();
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < uris.size(); ++i) {
+      benchmark::DoNotOptimize(bases[i].make_relative(uris[i]));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * total_bytes(uris));
+  state.SetItemsProcessed(state.iterations() * uris.size());
+}
+BENCHMARK(make_relative);
+
+static void hash(benchmark::State &state) {
+  run_operation(state, corpus(), [](const network::uri &instance) {
+    return std::hash<network::uri>()(instance);
+  });
+}
+BENCHMARK(hash);
+
+// Hashes the string, which is what uri::hash() costs, and what
+// cached_uri and shared_uri pay once when they are constructed.
+static void hash_string(benchmark::State &state) {
+  run_operation(state, corpus(), [](const network::uri &instance) {
+    return network::detail::hash_string(instance.view());
+  });
+}
+BENCHMARK(hash_string);
+
+static void unordered_set_find(benchmark::State &state) {
+  static const std::unordered_set<network::uri> set(std::begin(corpus()),
+                                                    std::end(corpus()));
+  run_operation(state, corpus(), [](const network::uri &instance) {
+    return set.find(instance) != std::end(set);
+  });
+}
+BENCHMARK(unordered_set_find);
+
+static void unordered_set_find_cached(benchmark::State &state) {
+  static const std::vector<network::cached_uri> uris(std::begin(corpus()),
+                                                     std::end(corpus()));
+  static const std::unordered_set<network::cached_uri> set(std::begin(uris),
+                                                           std::end(uris));
+  for (auto _ : state) {
+    for (const auto &instance : uris) {
+      benchmark::DoNotOptimize(set.find(instance) != std::end(set));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * uris.size());
+}
+BENCHMARK(unordered_set_find_cached);
+
+static void hash_syntax_based(benchmark::State &state) {
+  run_operation(state, corpus(), [](const network::uri &instance) {
+    return instance.hash(network::uri_comparison_level::syntax_based);
+  });
+}
+BENCHMARK(hash_syntax_based);
+
+// What hash_syntax_based costs without the streaming normalizer.
+static void hash_of_normalize(benchmark::State &state) {
+  run_operation(state, corpus(), [](const network::uri &instance) {
+    return instance.normalize(network::uri_comparison_level::syntax_based)
+        .hash();
+  });
+}
+BENCHMARK(hash_of_normalize);
+
+static void encode(benchmark::State &state,
+                   output_iterator (*encode)(input_iterator, input_iterator,
+                                             output_iterator)) {
+  run_encode(state, benchmark_urls::all_urls(), encode);
+}
+BENCHMARK_CAPTURE(encode, user_info,
+                  &network::uri::encode_user_info<input_iterator,
+                                                  output_iterator>);
+BENCHMARK_CAPTURE(encode, host,
+                  &network::uri::encode_host<input_iterator, output_iterator>);
+BENCHMARK_CAPTURE(encode, port,
+                  &network::uri::encode_port<input_iterator, output_iterator>);
+BENCHMARK_CAPTURE(encode, path,
+                  &network::uri::encode_path<input_iterator, output_iterator>);
+BENCHMARK_CAPTURE(encode, query,
+                  &network::uri::encode_query<input_iterator, output_iterator>);
+BENCHMARK_CAPTURE(
+    encode, query_component,
+    &network::uri::encode_query_component<input_iterator, output_iterator>);
+BENCHMARK_CAPTURE(encode, fragment,
+                  &network::uri::encode_fragment<input_iterator,
+                                                 output_iterator>);
+
+static void encode_query_key_value_pair(benchmark::State &state) {
+  run_encode(state, benchmark_urls::all_urls(),
+             [](input_iterator first, input_iterator last,
+                output_iterator out) {
+               // the key is the first half, and the value the second
+               auto middle = first + (last - first) / 2;
+               return network::uri::encode_query_key_value_pair(
+                   first, middle, middle, last, out);
+             });
+}
+BENCHMARK(encode_query_key_value_pair);
+
+static void decode(benchmark::State &state) {
+  static const std::vector<std::string> encoded = [] {
+    std::vector<std::string> urls;
+    for (const auto &url : benchmark_urls::all_urls()) {
+      std::string value;
+      network::uri::encode_query_component(std::begin(url), std::end(url),
+                                           std::back_inserter(value));
+      urls.push_back(value);
+    }
+    return urls;
+  }();
+
+  run_encode(state, encoded,
+             &network::uri::decode<input_iterator, output_iterator>);
+}
+BENCHMARK(decode);
+
+static void query_iterator(benchmark::State &state) {
+  static const std::vector<network::uri> uris = [] {
+    std::vector<network::uri> uris;
+    for (const auto &instance : corpus()) {
+      if (instance.has_query()) {
+        uris.push_back(instance);
+      }
+    }
+    return uris;
+  }();
+
+  run_operation(state, uris, [](const network::uri &instance) {
+    std::size_t count = 0;
+    for (auto it = instance.query_begin(); it != instance.query_end(); ++it) {
+      benchmark::DoNotOptimize(*it);
+      ++count;
+    }
+    return count;
+  });
+}
+BENCHMARK(query_iterator);
+
+static void uri_builder(benchmark::State &state) {
+  struct components {
+    std::string scheme, host, path, query;
+  };
+
+  static const std::vector<components> input = [] {
+    std::vector<components> input;
+    for (const auto &instance : hierarchical_corpus()) {
+      input.push_back({instance.scheme().to_string(),
+                       instance.host().to_string(),
+                       instance.path().to_string(),
+                       instance.query().to_string()});
+    }
+    return input;
+  }();
+
+  for (auto _ : state) {
+    for (const auto &value : input) {
+      network::uri_builder builder;
+      builder.scheme(value.scheme).host(value.host).path(value.path);
+      if (!value.query.empty()) {
+        builder.append_query_component(value.query);
+      }
+      benchmark::DoNotOptimize(builder.uri());
+    }
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          total_bytes(hierarchical_corpus()));
+  state.SetItemsProcessed(state.iterations() * input.size());
+}
+BENCHMARK(uri_builder);
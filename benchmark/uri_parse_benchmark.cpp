@@ -0,0 +1,132 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <benchmark/benchmark.h>
+#include <network/uri.hpp>
+#include <network/uri/detail/uri_parts.hpp>
+#include "../src/detail/uri_parse.hpp"
+#include "benchmark_urls.hpp"
+
+namespace {
+void run_parse(benchmark::State &state, const std::vector<std::string> &urls) {
+  for (auto _ : state) {
+    for (const auto &url : urls) {
+      network::string_view view(url);
+      auto it = std::begin(view), last = std::end(view);
+      network::detail::uri_parts parts;
+      benchmark::DoNotOptimize(network::detail::parse(it, last, parts));
+      benchmark::DoNotOptimize(parts);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          benchmark_urls::total_bytes(urls));
+  state.SetItemsProcessed(state.iterations() * urls.size());
+}
+
+void run_parse_generic(benchmark::State &state,
+                       const std::vector<std::string> &urls) {
+  for (auto _ : state) {
+    for (const auto &url : urls) {
+      network::string_view view(url);
+      auto it = std::begin(view), last = std::end(view);
+      network::detail::uri_parts parts;
+      network::uri_error error;
+      benchmark::DoNotOptimize(
+          network::detail::parse_generic(it, last, parts, error));
+      benchmark::DoNotOptimize(parts);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          benchmark_urls::total_bytes(urls));
+  state.SetItemsProcessed(state.iterations() * urls.size());
+}
+
+void run_construct(benchmark::State &state,
+                   const std::vector<std::string> &urls) {
+  for (auto _ : state) {
+    for (const auto &url : urls) {
+      std::error_code ec;
+      network::uri instance(url, ec);
+      benchmark::DoNotOptimize(instance);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          benchmark_urls::total_bytes(urls));
+  state.SetItemsProcessed(state.iterations() * urls.size());
+}
+
+void run_view(benchmark::State &state, const std::vector<std::string> &urls) {
+  for (auto _ : state) {
+    for (const auto &url : urls) {
+      std::error_code ec;
+      network::uri_view instance(url, ec);
+      benchmark::DoNotOptimize(instance);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          benchmark_urls::total_bytes(urls));
+  state.SetItemsProcessed(state.iterations() * urls.size());
+}
+}  // namespace
+
+static void parse_valid_urls(benchmark::State &state) {
+  run_parse(state, benchmark_urls::valid_urls());
+}
+BENCHMARK(parse_valid_urls);
+
+static void parse_generic_valid_urls(benchmark::State &state) {
+  run_parse_generic(state, benchmark_urls::valid_urls());
+}
+BENCHMARK(parse_generic_valid_urls);
+
+static void construct_valid_urls(benchmark::State &state) {
+  run_construct(state, benchmark_urls::valid_urls());
+}
+BENCHMARK(construct_valid_urls);
+
+static void view_valid_urls(benchmark::State &state) {
+  run_view(state, benchmark_urls::valid_urls());
+}
+BENCHMARK(view_valid_urls);
+
+static void parse_long_query_urls(benchmark::State &state) {
+  run_parse(state, benchmark_urls::long_query_urls());
+}
+BENCHMARK(parse_long_query_urls);
+
+static void parse_generic_long_query_urls(benchmark::State &state) {
+  run_parse_generic(state, benchmark_urls::long_query_urls());
+}
+BENCHMARK(parse_generic_long_query_urls);
+
+static void construct_long_query_urls(benchmark::State &state) {
+  run_construct(state, benchmark_urls::long_query_urls());
+}
+BENCHMARK(construct_long_query_urls);
+
+static void view_long_query_urls(benchmark::State &state) {
+  run_view(state, benchmark_urls::long_query_urls());
+}
+BENCHMARK(view_long_query_urls);
+
+static void parse_ipv6_urls(benchmark::State &state) {
+  run_parse(state, benchmark_urls::ipv6_urls());
+}
+BENCHMARK(parse_ipv6_urls);
+
+static void construct_ipv6_urls(benchmark::State &state) {
+  run_construct(state, benchmark_urls::ipv6_urls());
+}
+BENCHMARK(construct_ipv6_urls);
+
+static void parse_deep_path_urls(benchmark::State &state) {
+  run_parse(state, benchmark_urls::deep_path_urls());
+}
+BENCHMARK(parse_deep_path_urls);
+
+static void construct_deep_path_urls(benchmark::State &state) {
+  run_construct(state, benchmark_urls::deep_path_urls());
+}
+BENCHMARK(construct_deep_path_urls);
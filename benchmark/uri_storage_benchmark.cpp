@@ -0,0 +1,297 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the storage of the uri, small_uri, shared_uri and uri_pool
+// in containers that are much bigger than the cache. Run with
+// --benchmark_perf_counters=CYCLES,CACHE-MISSES to count cache misses,
+// if Google Benchmark was built with libpfm.
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <network/uri.hpp>
+#include "benchmark_urls.hpp"
+
+namespace {
+const std::size_t container_size = 1u << 18;
+
+// Typical crawler URLs, most of them between 40 and 120 bytes long.
+const std::vector<std::string> &typical_urls() {
+  static const std::vector<std::string> urls = [] {
+    std::vector<std::string> urls;
+    std::mt19937 random(2026);
+    for (std::size_t i = 0; urls.size() < container_size; ++i) {
+      const auto n = std::to_string(i);
+      switch (random() % 4) {
+        case 0:
+          urls.push_back("http://www.example" + n + ".com/");
+          break;
+        case 1:
+          urls.push_back("https://www.example.com/articles/" + n +
+                         "/index.html");
+          break;
+        case 2:
+          urls.push_back("https://shop.example.com/catalog/item-" + n +
+                         "?ref=home&lang=en");
+          break;
+        default:
+          urls.push_back("https://cdn.example.com/static/images/2026/10/" + n +
+                         "/thumbnail-large.jpg?v=" + n + "#main");
+          break;
+      }
+    }
+    return urls;
+  }();
+  return urls;
+}
+
+// The URIs are shuffled after they're constructed, as if they had been
+// sorted or queued, so the strings that a uri puts on the heap are no
+// longer in the same order as the container.
+template <class Uri>
+const std::vector<Uri> &container() {
+  static const std::vector<Uri> uris = [] {
+    std::vector<Uri> uris;
+    uris.reserve(container_size);
+    for (const auto &url : typical_urls()) {
+      uris.emplace_back(url);
+    }
+    std::shuffle(std::begin(uris), std::end(uris), std::mt19937(2026));
+    return uris;
+  }();
+  return uris;
+}
+
+template <class Uri>
+std::size_t total_bytes(const std::vector<Uri> &uris) {
+  std::size_t bytes = 0;
+  for (const auto &instance : uris) {
+    bytes += instance.view().size();
+  }
+  return bytes;
+}
+
+template <class Uri>
+void set_processed(benchmark::State &state, const std::vector<Uri> &uris) {
+  state.SetBytesProcessed(state.iterations() * total_bytes(uris));
+  state.SetItemsProcessed(state.iterations() * uris.size());
+}
+}  // namespace
+
+// Reads the host and the last character of the path of every URI.
+template <class Uri>
+static void container_scan(benchmark::State &state) {
+  const auto &uris = container<Uri>();
+  for (auto _ : state) {
+    std::size_t checksum = 0;
+    for (const auto &instance : uris) {
+      for (auto c : instance.host()) {
+        checksum += static_cast<unsigned char>(c);
+      }
+      checksum += instance.path().empty() ? 0 : instance.path().back();
+    }
+    benchmark::DoNotOptimize(checksum);
+  }
+  set_processed(state, uris);
+}
+BENCHMARK_TEMPLATE(container_scan, network::uri);
+BENCHMARK_TEMPLATE(container_scan, network::small_uri<128>);
+BENCHMARK_TEMPLATE(container_scan, network::small_uri<256>);
+BENCHMARK_TEMPLATE(container_scan, network::shared_uri);
+
+template <class Uri>
+static void container_copy(benchmark::State &state) {
+  const auto &uris = container<Uri>();
+  for (auto _ : state) {
+    std::vector<Uri> copy(uris);
+    benchmark::DoNotOptimize(copy.data());
+  }
+  set_processed(state, uris);
+}
+BENCHMARK_TEMPLATE(container_copy, network::uri)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(container_copy, network::small_uri<128>)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(container_copy, network::small_uri<256>)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(container_copy, network::shared_uri)
+    ->Unit(benchmark::kMillisecond);
+
+template <class Uri>
+static void container_sort(benchmark::State &state) {
+  const auto &uris = container<Uri>();
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::vector<Uri> copy(uris);
+    state.ResumeTiming();
+    std::sort(std::begin(copy), std::end(copy));
+    benchmark::DoNotOptimize(copy.data());
+  }
+  set_processed(state, uris);
+}
+BENCHMARK_TEMPLATE(container_sort, network::uri)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(container_sort, network::small_uri<128>)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(container_sort, network::small_uri<256>)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(container_sort, network::shared_uri)
+    ->Unit(benchmark::kMillisecond);
+
+// Parses every URL into a new container.
+template <class Uri>
+static void container_construct(benchmark::State &state) {
+  const auto &urls = typical_urls();
+  for (auto _ : state) {
+    std::vector<Uri> uris;
+    uris.reserve(urls.size());
+    for (const auto &url : urls) {
+      uris.emplace_back(url);
+    }
+    benchmark::DoNotOptimize(uris.data());
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          benchmark_urls::total_bytes(urls));
+  state.SetItemsProcessed(state.iterations() * urls.size());
+}
+BENCHMARK_TEMPLATE(container_construct, network::uri)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(container_construct, network::small_uri<128>)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(container_construct, network::small_uri<256>)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(container_construct, network::shared_uri)
+    ->Unit(benchmark::kMillisecond);
+
+// Passes every URI through a queue, a dedup stage, a fetcher and a log,
+// each of which keeps its own copy.
+template <class Uri>
+static void pipeline_fan_out(benchmark::State &state) {
+  const auto &uris = container<Uri>();
+  const std::size_t stages = 4;
+  for (auto _ : state) {
+    std::vector<std::vector<Uri>> pipeline(stages);
+    for (auto &stage : pipeline) {
+      stage.reserve(uris.size());
+    }
+    for (const auto &instance : uris) {
+      for (auto &stage : pipeline) {
+        stage.push_back(instance);
+      }
+    }
+    benchmark::DoNotOptimize(pipeline.data());
+  }
+  set_processed(state, uris);
+}
+BENCHMARK_TEMPLATE(pipeline_fan_out, network::uri)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(pipeline_fan_out, network::small_uri<128>)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(pipeline_fan_out, network::shared_uri)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(pipeline_fan_out, network::local_shared_uri)
+    ->Unit(benchmark::kMillisecond);
+
+namespace {
+const std::size_t link_count = 1u << 20;
+const std::size_t distinct_links = 1u << 16;
+
+// The links in a crawled graph, where a few pages are linked to from
+// most of the others.
+const std::vector<std::string> &links() {
+  static const std::vector<std::string> links = [] {
+    std::vector<std::string> links;
+    links.reserve(link_count);
+    std::mt19937 random(2026);
+    std::geometric_distribution<std::size_t> popularity(0.001);
+    for (std::size_t i = 0; i < link_count; ++i) {
+      links.push_back(typical_urls()[popularity(random) % distinct_links]);
+    }
+    return links;
+  }();
+  return links;
+}
+
+void set_links_processed(benchmark::State &state, std::size_t bytes) {
+  state.SetBytesProcessed(state.iterations() *
+                          benchmark_urls::total_bytes(links()));
+  state.SetItemsProcessed(state.iterations() * links().size());
+  state.counters["bytes_per_link"] =
+      static_cast<double>(bytes) / static_cast<double>(links().size());
+}
+}  // namespace
+
+// Stores every link as a uri. The memory doesn't include the
+// allocator's overhead.
+static void link_graph_uri(benchmark::State &state) {
+  std::size_t bytes = 0;
+  for (auto _ : state) {
+    std::vector<network::uri> graph;
+    graph.reserve(links().size());
+    for (const auto &link : links()) {
+      graph.emplace_back(link);
+    }
+    bytes = graph.capacity() * sizeof(network::uri);
+    for (const auto &instance : graph) {
+      // strings that are this short don't allocate
+      bytes += (instance.view().size() > 15) ? instance.view().size() + 1 : 0;
+    }
+    benchmark::DoNotOptimize(graph.data());
+  }
+  set_links_processed(state, bytes);
+}
+BENCHMARK(link_graph_uri)->Unit(benchmark::kMillisecond);
+
+// Stores every link as a handle to a uri_pool.
+static void link_graph_pool(benchmark::State &state) {
+  std::size_t bytes = 0;
+  for (auto _ : state) {
+    network::uri_pool pool;
+    std::vector<network::uri_pool::handle_type> graph;
+    graph.reserve(links().size());
+    pool.insert(std::begin(links()), std::end(links()),
+                std::back_inserter(graph));
+    bytes = pool.allocated_bytes() +
+            (graph.capacity() * sizeof(network::uri_pool::handle_type));
+    benchmark::DoNotOptimize(graph.data());
+  }
+  set_links_processed(state, bytes);
+}
+BENCHMARK(link_graph_pool)->Unit(benchmark::kMillisecond);
+
+// Compares every link with the one before it.
+static void link_equality_uri(benchmark::State &state) {
+  static const std::vector<network::uri> graph(std::begin(links()),
+                                               std::end(links()));
+  for (auto _ : state) {
+    std::size_t equal = 0;
+    for (std::size_t i = 1; i < graph.size(); ++i) {
+      equal += (graph[i - 1] == graph[i]) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(equal);
+  }
+  state.SetItemsProcessed(state.iterations() * graph.size());
+}
+BENCHMARK(link_equality_uri);
+
+static void link_equality_pool(benchmark::State &state) {
+  static network::uri_pool pool;
+  static const std::vector<network::uri_pool::handle_type> graph = [] {
+    std::vector<network::uri_pool::handle_type> graph;
+    pool.insert(std::begin(links()), std::end(links()),
+                std::back_inserter(graph));
+    return graph;
+  }();
+  for (auto _ : state) {
+    std::size_t equal = 0;
+    for (std::size_t i = 1; i < graph.size(); ++i) {
+      equal += (graph[i - 1] == graph[i]) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(equal);
+  }
+  state.SetItemsProcessed(state.iterations() * graph.size());
+}
+BENCHMARK(link_equality_pool);
@@ -0,0 +1,93 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <system_error>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <network/uri.hpp>
+#include "benchmark_urls.hpp"
+
+// Each thread runs the same operation over its own pass of the corpus,
+// so the time per iteration should stay flat as threads are added. If
+// it doesn't, something in the operation is shared between threads
+// (a global locale, a reference count or an allocator lock).
+
+namespace {
+// The URLs in the corpora with an authority, that can be normalized.
+const std::vector<network::uri> &corpus() {
+  static const std::vector<network::uri> uris = [] {
+    std::vector<network::uri> uris;
+    for (const auto &url : benchmark_urls::all_urls()) {
+      std::error_code ec;
+      network::uri instance(url, ec);
+      if (ec || !instance.has_authority()) {
+        continue;
+      }
+
+      try {
+        instance.normalize(network::uri_comparison_level::syntax_based);
+        uris.push_back(instance);
+      } catch (const std::exception &) {
+      }
+    }
+    return uris;
+  }();
+  return uris;
+}
+
+std::size_t total_bytes(const std::vector<network::uri> &uris) {
+  std::size_t bytes = 0;
+  for (const auto &instance : uris) {
+    bytes += instance.string().size();
+  }
+  return bytes;
+}
+
+template <class Operation>
+void run_threads(benchmark::State &state, Operation operation) {
+  const auto &uris = corpus();
+  for (auto _ : state) {
+    for (const auto &instance : uris) {
+      benchmark::DoNotOptimize(operation(instance));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * total_bytes(uris));
+  state.SetItemsProcessed(state.iterations() * uris.size());
+}
+}  // namespace
+
+static void parse_threads(benchmark::State &state) {
+  run_threads(state, [](const network::uri &instance) {
+    std::error_code ec;
+    network::uri result(instance.view(), ec);
+    return result;
+  });
+}
+BENCHMARK(parse_threads)->ThreadRange(1, 64)->UseRealTime();
+
+static void normalize_threads(benchmark::State &state) {
+  run_threads(state, [](const network::uri &instance) {
+    return instance.normalize(network::uri_comparison_level::syntax_based);
+  });
+}
+BENCHMARK(normalize_threads)->ThreadRange(1, 64)->UseRealTime();
+
+static void build_threads(benchmark::State &state) {
+  run_threads(state, [](const network::uri &instance) {
+    network::uri_builder builder;
+    builder.scheme(instance.scheme())
+        .host(instance.host())
+        .path(instance.path());
+    if (instance.has_port()) {
+      builder.port(instance.port());
+    }
+    if (instance.has_query()) {
+      builder.append_query_component(instance.query());
+    }
+    return builder.uri();
+  });
+}
+BENCHMARK(build_threads)->ThreadRange(1, 64)->UseRealTime();
@@ -389,6 +389,8 @@ class optional {
 
  private:
   T *ptr() { return std::addressof(base_type::storage_.value_); }
+
+  T const *ptr() const { return std::addressof(base_type::storage_.value_); }
 };
 
 /**
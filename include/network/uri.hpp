@@ -28,11 +28,23 @@
  * the URI in this library.
  *
  * \file
- * \brief Contains the uri, uri_builder classes and functions
- *        for percent encoding and decoding.
+ * \brief Contains the uri, uri_view, basic_uri, small_uri, shared_uri,
+ *        uri_pool, cached_uri, uri_builder classes, parse_uri, the
+ *        scheme registry and functions for percent encoding and
+ *        decoding.
  */
 
 #include <network/uri/uri.hpp>
+#include <network/uri/uri_view.hpp>
+#include <network/uri/basic_uri.hpp>
+#include <network/uri/small_uri.hpp>
+#include <network/uri/shared_uri.hpp>
+#include <network/uri/uri_parse_result.hpp>
+#include <network/uri/uri_incremental_parser.hpp>
+#include <network/uri/uri_batch.hpp>
+#include <network/uri/uri_pool.hpp>
+#include <network/uri/cached_uri.hpp>
+#include <network/uri/uri_schemes.hpp>
 #include <network/uri/uri_io.hpp>
 
 #endif  // NETWORK_URI_HPP
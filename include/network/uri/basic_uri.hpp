@@ -0,0 +1,425 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NETWORK_URI_BASIC_URI_INC
+#define NETWORK_URI_BASIC_URI_INC
+
+/**
+ * \file
+ * \brief Contains the basic_uri class template.
+ */
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <network/string_view.hpp>
+#include <network/uri/config.hpp>
+#include <network/uri/uri.hpp>
+#include <network/uri/uri_view.hpp>
+#include <network/uri/uri_parse_result.hpp>
+#include <network/uri/uri_builder.hpp>
+#include <network/uri/detail/uri_accessors.hpp>
+#include <network/uri/detail/uri_assemble.hpp>
+#include <network/uri/detail/uri_parts.hpp>
+
+#if defined(NETWORK_URI_HAS_MEMORY_RESOURCE)
+#include <memory_resource>
+#endif  // defined(NETWORK_URI_HAS_MEMORY_RESOURCE)
+
+#ifdef NETWORK_URI_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4251 4231 4660)
+#endif
+
+namespace network {
+/**
+ * \ingroup uri
+ * \class basic_uri network/uri/basic_uri.hpp network/uri.hpp
+ * \brief A class that parses a URI into its component parts, and
+ *        keeps its string in memory from an allocator.
+ *
+ * The basic_uri has the same accessors as the uri, and is
+ * allocator-aware in the same way as the standard containers: the
+ * allocator can be passed as the last argument to each constructor, so
+ * a container that uses a scoped or polymorphic allocator passes its
+ * allocator on to its elements. Only the string is allocated, and it
+ * is allocated once.
+ *
+ * With C++ 17, network::pmr::uri uses a std::pmr::polymorphic_allocator,
+ * so URIs can be put in a monotonic buffer resource and thrown away
+ * with it.
+ *
+ * Example:
+ *
+ * \code
+ * std::pmr::monotonic_buffer_resource arena;
+ * std::pmr::vector<network::pmr::uri> uris(&arena);
+ * uris.emplace_back("http://cpp-netlib.org/");
+ * assert("cpp-netlib.org" == uris.front().host());
+ * \endcode
+ *
+ * normalize, resolve, make_relative and compare use a temporary uri,
+ * whose memory comes from the global heap. Their results use the
+ * allocator of this object.
+ *
+ * \sa uri
+ */
+template <class Allocator>
+class basic_uri : public detail::uri_accessors<basic_uri<Allocator>> {
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+  friend class detail::uri_accessors<basic_uri>;
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+ public:
+  /**
+   * \brief The allocator type.
+   */
+  typedef Allocator allocator_type;
+
+  /**
+   * \brief The URI string_type.
+   */
+  typedef std::basic_string<char, std::char_traits<char>, Allocator>
+      string_type;
+
+  /**
+   * \brief Default constructor.
+   */
+  basic_uri() : uri_(), uri_parts_() {}
+
+  /**
+   * \brief Constructor.
+   * \param alloc The allocator.
+   */
+  explicit basic_uri(const allocator_type &alloc) : uri_(alloc), uri_parts_() {}
+
+  /**
+   * \brief Constructor.
+   * \param source A string that is to be parsed as a URI. Leading
+   *        and trailing whitespace is ignored.
+   * \param alloc The allocator.
+   * \throws uri_syntax_error if the source is not a valid URI.
+   * \throws std::bad_alloc If the underlying string cannot be allocated.
+   */
+  explicit basic_uri(string_view source,
+                     const allocator_type &alloc = allocator_type())
+      : uri_(alloc), uri_parts_() {
+    if (!initialize(source)) {
+      throw uri_syntax_error();
+    }
+  }
+
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+  basic_uri(string_view source, std::error_code &ec,
+            const allocator_type &alloc = allocator_type())
+      : uri_(alloc), uri_parts_() {
+    if (!initialize(source)) {
+      ec = make_error_code(uri_error::invalid_syntax);
+    }
+  }
+
+  explicit basic_uri(const uri_builder &builder,
+                     const allocator_type &alloc = allocator_type())
+      : uri_(alloc), uri_parts_() {
+    detail::assemble_uri(uri_, uri_parts_, builder.scheme_, builder.user_info_,
+                         builder.host_, builder.port_, builder.path_,
+                         builder.query_, builder.fragment_);
+  }
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+  /**
+   * \brief Constructor.
+   * \param view A URI that has already been parsed. The string is
+   *        copied but it isn't parsed again.
+   * \param alloc The allocator.
+   * \throws std::bad_alloc If the underlying string cannot be allocated.
+   */
+  explicit basic_uri(const uri_view &view,
+                     const allocator_type &alloc = allocator_type())
+      : uri_(view.view().data(), view.view().size(), alloc),
+        uri_parts_(base_type::parts_of(view)) {}
+
+  /**
+   * \brief Constructor.
+   * \param other A uri. The string is copied but it isn't parsed
+   *        again.
+   * \param alloc The allocator.
+   * \throws std::bad_alloc If the underlying string cannot be allocated.
+   */
+  explicit basic_uri(const uri &other,
+                     const allocator_type &alloc = allocator_type())
+      : uri_(other.view().data(), other.view().size(), alloc),
+        uri_parts_(base_type::parts_of(other)) {}
+
+  /**
+   * \brief Copy constructor.
+   * \throws std::bad_alloc If the underlying string cannot be allocated.
+   */
+  basic_uri(const basic_uri &other)
+      : uri_(other.uri_), uri_parts_(other.uri_parts_) {}
+
+  /**
+   * \brief Copy constructor, with a different allocator.
+   * \throws std::bad_alloc If the underlying string cannot be allocated.
+   */
+  basic_uri(const basic_uri &other, const allocator_type &alloc)
+      : uri_(other.uri_, alloc), uri_parts_(other.uri_parts_) {}
+
+  /**
+   * \brief Move constructor.
+   */
+  basic_uri(basic_uri &&other) noexcept : uri_(std::move(other.uri_)),
+                                          uri_parts_(other.uri_parts_) {
+    other.uri_.clear();
+    other.uri_parts_.clear();
+  }
+
+  /**
+   * \brief Move constructor, with a different allocator. If the
+   *        allocators aren't equal, the string is copied.
+   * \throws std::bad_alloc If the underlying string cannot be allocated.
+   */
+  basic_uri(basic_uri &&other, const allocator_type &alloc)
+      : uri_(std::move(other.uri_), alloc), uri_parts_(other.uri_parts_) {
+    other.uri_.clear();
+    other.uri_parts_.clear();
+  }
+
+  /**
+   * \brief Copy assignment operator.
+   * \throws std::bad_alloc If the underlying string cannot be allocated.
+   */
+  basic_uri &operator=(const basic_uri &other) {
+    uri_ = other.uri_;
+    uri_parts_ = other.uri_parts_;
+    return *this;
+  }
+
+  /**
+   * \brief Move assignment operator.
+   * \throws std::bad_alloc If the allocators aren't equal and aren't
+   *         propagated, and the string cannot be allocated.
+   */
+  basic_uri &operator=(basic_uri &&other) {
+    if (this != &other) {
+      uri_ = std::move(other.uri_);
+      uri_parts_ = other.uri_parts_;
+      other.uri_.clear();
+      other.uri_parts_.clear();
+    }
+    return *this;
+  }
+
+  /**
+   * \brief Swaps one basic_uri object with another.
+   * \param other The other basic_uri object.
+   * \pre The allocators are equal, or they are propagated on swap.
+   */
+  void swap(basic_uri &other) noexcept {
+    uri_.swap(other.uri_);
+    std::swap(uri_parts_, other.uri_parts_);
+  }
+
+  /**
+   * \brief Returns the allocator.
+   * \returns The allocator of the underlying string.
+   */
+  allocator_type get_allocator() const noexcept {
+    return uri_.get_allocator();
+  }
+
+  /**
+   * \brief Normalizes a uri object at a given level in the
+   *        comparison ladder.
+   * \param level The comparison level.
+   * \returns A normalized uri, with the same allocator.
+   * \post compare(normalize(uri, level), level) == 0
+   * \throws uri_builder_error if the path has a ".." segment with
+   *         nothing to remove.
+   * \throws std::bad_alloc
+   */
+  basic_uri normalize(uri_comparison_level level) const {
+    return basic_uri(uri(this->as_view()).normalize(level), get_allocator());
+  }
+
+  /**
+   * \brief Returns a relative reference against the base URI.
+   * \param base The base URI.
+   * \returns A relative reference of this URI against the base, with
+   *          the same allocator.
+   * \throws std::bad_alloc
+   */
+  basic_uri make_relative(const basic_uri &base) const {
+    return basic_uri(uri(this->as_view()).make_relative(uri(base.as_view())),
+                     get_allocator());
+  }
+
+  /**
+   * \brief Resolves a relative reference against the given URI.
+   * \param base The base URI to resolve against.
+   * \returns An absolute URI, with the same allocator.
+   * \throws std::bad_alloc
+   */
+  basic_uri resolve(const basic_uri &base) const {
+    return basic_uri(uri(this->as_view()).resolve(uri(base.as_view())),
+                     get_allocator());
+  }
+
+  /**
+   * \brief Compares this URI against another, corresponding to the
+   *        level in the comparison ladder.
+   * \param other The other URI.
+   * \param level The level in the comparison ladder.
+   * \returns \c 0 if the URIs are considered equal, \c -1 if this is
+   *         less than other and and 1 if this is greater than
+   *         other.
+   */
+  int compare(const basic_uri &other, uri_comparison_level level) const
+      noexcept {
+    return detail::compare_normalized(this->view(), uri_parts(), other.view(),
+                                      other.uri_parts(), level);
+  }
+
+ private:
+  typedef detail::uri_accessors<basic_uri> base_type;
+
+  bool initialize(string_view source) {
+    uri_view view;
+    if (!base_type::parse(source, view)) {
+      return false;
+    }
+    uri_.assign(view.view().data(), view.view().size());
+    uri_parts_ = base_type::parts_of(view);
+    return true;
+  }
+
+  const char *uri_data() const noexcept { return uri_.data(); }
+
+  std::size_t uri_size() const noexcept { return uri_.size(); }
+
+  const detail::compact_uri_parts &uri_parts() const noexcept {
+    return uri_parts_;
+  }
+
+  string_type uri_;
+  detail::compact_uri_parts uri_parts_;
+};
+
+/**
+ * \brief Swaps one basic_uri object with another.
+ */
+template <class Allocator>
+inline void swap(basic_uri<Allocator> &lhs,
+                 basic_uri<Allocator> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+/**
+ * \brief Equality operator for the \c basic_uri.
+ */
+template <class Allocator>
+inline bool operator==(const basic_uri<Allocator> &lhs,
+                       const basic_uri<Allocator> &rhs) noexcept {
+  return lhs.view() == rhs.view();
+}
+
+/**
+ * \brief Equality operator for the \c basic_uri.
+ */
+template <class Allocator>
+inline bool operator==(const basic_uri<Allocator> &lhs,
+                       const char *rhs) noexcept {
+  return lhs.view() == string_view{rhs};
+}
+
+/**
+ * \brief Equality operator for the \c basic_uri.
+ */
+template <class Allocator>
+inline bool operator==(const char *lhs,
+                       const basic_uri<Allocator> &rhs) noexcept {
+  return rhs == lhs;
+}
+
+/**
+ * \brief Inequality operator for the \c basic_uri.
+ */
+template <class Allocator>
+inline bool operator!=(const basic_uri<Allocator> &lhs,
+                       const basic_uri<Allocator> &rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+/**
+ * \brief Less-than operator for the \c basic_uri.
+ */
+template <class Allocator>
+inline bool operator<(const basic_uri<Allocator> &lhs,
+                      const basic_uri<Allocator> &rhs) noexcept {
+  return lhs.view() < rhs.view();
+}
+
+/**
+ * \brief Greater-than operator for the \c basic_uri.
+ */
+template <class Allocator>
+inline bool operator>(const basic_uri<Allocator> &lhs,
+                      const basic_uri<Allocator> &rhs) noexcept {
+  return rhs < lhs;
+}
+
+/**
+ * \brief Less-than-or-equal-to operator for the \c basic_uri.
+ */
+template <class Allocator>
+inline bool operator<=(const basic_uri<Allocator> &lhs,
+                       const basic_uri<Allocator> &rhs) noexcept {
+  return !(rhs < lhs);
+}
+
+/**
+ * \brief Greater-than-or-equal-to operator for the \c basic_uri.
+ */
+template <class Allocator>
+inline bool operator>=(const basic_uri<Allocator> &lhs,
+                       const basic_uri<Allocator> &rhs) noexcept {
+  return !(lhs < rhs);
+}
+
+template <class Allocator>
+inline basic_uri<Allocator> uri_builder::uri(const Allocator &alloc) const {
+  return basic_uri<Allocator>(*this, alloc);
+}
+
+#if defined(NETWORK_URI_HAS_MEMORY_RESOURCE)
+namespace pmr {
+/**
+ * \brief A URI whose string is allocated from a
+ *        std::pmr::memory_resource.
+ */
+typedef basic_uri<std::pmr::polymorphic_allocator<char>> uri;
+}  // namespace pmr
+#endif  // defined(NETWORK_URI_HAS_MEMORY_RESOURCE)
+}  // namespace network
+
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+namespace std {
+template <class Allocator>
+struct hash<network::basic_uri<Allocator>> {
+  std::size_t operator()(
+      const network::basic_uri<Allocator> &uri_) const noexcept {
+    return uri_.hash();
+  }
+};
+}  // namespace std
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+#ifdef NETWORK_URI_MSVC
+#pragma warning(pop)
+#endif
+
+#endif  // NETWORK_URI_BASIC_URI_INC
@@ -0,0 +1,210 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NETWORK_URI_CACHED_URI_INC
+#define NETWORK_URI_CACHED_URI_INC
+
+/**
+ * \file
+ * \brief Contains the cached_uri class.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <network/string_view.hpp>
+#include <network/uri/config.hpp>
+#include <network/uri/uri.hpp>
+
+#ifdef NETWORK_URI_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4251 4231 4660)
+#endif
+
+namespace network {
+/**
+ * \ingroup uri
+ * \class cached_uri network/uri/cached_uri.hpp network/uri.hpp
+ * \brief A uri that keeps its normalized form at each level in the
+ *        comparison ladder, once it has been asked for it.
+ *
+ * The first call to normalize at a level computes the normalized uri
+ * and stores it, and later calls return it. A URI that is already
+ * normalized is found without allocating, and its normalized form is
+ * the URI itself. compare and hash use the normalized forms, so a
+ * cached_uri that is compared many times is normalized once. The hash
+ * of the URI string is stored too, which uri doesn't do, so a
+ * cached_uri in a hash container isn't hashed again.
+ *
+ * Example:
+ *
+ * \code
+ * network::cached_uri instance("HTTP://cpp-netlib.org/a/../b");
+ * assert(instance.normalize(network::uri_comparison_level::syntax_based)
+ *            .view() == "http://cpp-netlib.org/b");
+ * \endcode
+ *
+ * Const member functions may be called from several threads at once.
+ * If two threads normalize a URI at the same level at the same time,
+ * both compute it and one of them is kept.
+ */
+class cached_uri {
+ public:
+  /**
+   * \brief A reference to the underlying string_type parts.
+   */
+  typedef network::string_view string_view;
+
+  /**
+   * \brief Default constructor.
+   */
+  cached_uri();
+
+  /**
+   * \brief Constructor.
+   * \param instance The URI.
+   */
+  explicit cached_uri(uri instance);
+
+  /**
+   * \brief Constructor.
+   * \param source A source string that is to be parsed as a URI.
+   * \throws uri_syntax_error if the source is not a valid URI.
+   * \throws std::bad_alloc
+   */
+  template <class Source>
+  explicit cached_uri(const Source &source) : cached_uri(uri(source)) {}
+
+  /**
+   * \brief Copy constructor. The normalized forms are computed again,
+   *        unless the URI was already normalized.
+   */
+  cached_uri(const cached_uri &other);
+
+  /**
+   * \brief Move constructor. The normalized forms are moved with the
+   *        URI.
+   */
+  cached_uri(cached_uri &&other) noexcept;
+
+  /**
+   * \brief Assignment operator.
+   */
+  cached_uri &operator=(cached_uri other) noexcept;
+
+  /**
+   * \brief Destructor.
+   */
+  ~cached_uri();
+
+  /**
+   * \brief Swaps one cached_uri object with another.
+   * \param other The other cached_uri object.
+   */
+  void swap(cached_uri &other) noexcept;
+
+  /**
+   * \brief Returns the URI.
+   * \returns The URI.
+   */
+  const uri &get() const noexcept { return uri_; }
+
+  /**
+   * \brief Returns the URI as a string_view object.
+   * \returns A URI string view.
+   */
+  string_view view() const noexcept { return uri_.view(); }
+
+  /**
+   * \brief Returns the URI normalized at a given level in the
+   *        comparison ladder, which is computed the first time that
+   *        it's asked for.
+   * \param level The comparison level.
+   * \returns The normalized URI, which is valid for as long as this
+   *          object is and isn't modified.
+   * \throws uri_builder_error if the path has a ".." segment with
+   *         nothing to remove.
+   * \throws std::bad_alloc
+   */
+  const uri &normalize(uri_comparison_level level) const;
+
+  /**
+   * \brief Returns a hash of the URI string, which is computed once,
+   *        when the cached_uri is constructed.
+   * \returns The hash, which is the same as uri::hash().
+   */
+  std::size_t hash() const noexcept { return hash_; }
+
+  /**
+   * \brief Returns a hash of the URI as if it had been normalized at a
+   *        given level in the comparison ladder.
+   * \param level The comparison level.
+   * \returns The hash, which is the same as uri::hash(level).
+   */
+  std::size_t hash(uri_comparison_level level) const noexcept;
+
+  /**
+   * \brief Compares this URI against another, corresponding to the
+   *        level in the comparison ladder.
+   * \param other The other URI.
+   * \param level The level in the comparison ladder.
+   * \returns The same as uri::compare.
+   */
+  int compare(const cached_uri &other, uri_comparison_level level) const
+      noexcept;
+
+ private:
+  // The normalized forms at the syntax_based and scheme_based levels,
+  // the address of uri_ if the URI is already normalized, or a marker if
+  // it can't be normalized.
+  static const std::size_t level_count = 2;
+
+  static std::size_t index(uri_comparison_level level) noexcept;
+  const uri *store_normalized(uri_comparison_level level) const;
+  const uri *find(uri_comparison_level level) const noexcept;
+  void release() noexcept;
+
+  uri uri_;
+  std::size_t hash_;
+  mutable std::atomic<const uri *> normalized_[level_count];
+};
+
+/**
+ * \brief Swaps one cached_uri object with another.
+ */
+inline void swap(cached_uri &lhs, cached_uri &rhs) noexcept { lhs.swap(rhs); }
+
+/**
+ * \brief Equality operator for the \c cached_uri, which compares the
+ *        URI strings.
+ */
+inline bool operator==(const cached_uri &lhs, const cached_uri &rhs) noexcept {
+  return lhs.view() == rhs.view();
+}
+
+/**
+ * \brief Inequality operator for the \c cached_uri.
+ */
+inline bool operator!=(const cached_uri &lhs, const cached_uri &rhs) noexcept {
+  return !(lhs == rhs);
+}
+}  // namespace network
+
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+namespace std {
+template <>
+struct hash<network::cached_uri> {
+  std::size_t operator()(const network::cached_uri &uri_) const noexcept {
+    return uri_.hash();
+  }
+};
+}  // namespace std
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+#ifdef NETWORK_URI_MSVC
+#pragma warning(pop)
+#endif
+
+#endif  // NETWORK_URI_CACHED_URI_INC
@@ -18,4 +18,31 @@
 #define NETWORK_URI_MSVC _MSC_VER
 #endif  // _MSC_VER
 
+// Functions that are constexpr with the relaxed rules of C++14 (loops,
+// local variables and more than one statement), and ordinary functions
+// before that.
+#if defined(__cpp_constexpr) && (__cpp_constexpr >= 201304)
+#define NETWORK_URI_HAS_CXX14_CONSTEXPR 1
+#define NETWORK_URI_CXX14_CONSTEXPR constexpr
+#else
+#define NETWORK_URI_CXX14_CONSTEXPR
+#endif  // defined(__cpp_constexpr) && (__cpp_constexpr >= 201304)
+
+// Functions that are never inlined into their callers.
+#if defined(NETWORK_URI_MSVC)
+#define NETWORK_URI_NOINLINE __declspec(noinline)
+#elif defined(__GNUC__)
+#define NETWORK_URI_NOINLINE __attribute__((noinline))
+#else
+#define NETWORK_URI_NOINLINE
+#endif  // defined(NETWORK_URI_MSVC)
+
+// std::pmr::polymorphic_allocator, for network::pmr::uri.
+#if defined(__has_include)
+#if __has_include(<memory_resource>) && \
+    ((__cplusplus >= 201703L) || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L))
+#define NETWORK_URI_HAS_MEMORY_RESOURCE 1
+#endif
+#endif  // defined(__has_include)
+
 #endif  // NETWORK_URI_CONFIG_INC
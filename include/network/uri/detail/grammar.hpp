@@ -0,0 +1,275 @@
+// Copyright 2016 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NETWORK_DETAIL_URI_GRAMMAR_INC
+#define NETWORK_DETAIL_URI_GRAMMAR_INC
+
+#include <network/string_view.hpp>
+#include <network/uri/config.hpp>
+#include <cstddef>
+#include <limits>
+#include <string>
+
+namespace network {
+namespace detail {
+// Character classes from the RFC 3986 grammar (Appendix A). Each
+// byte is classified once, at compile time, into a 256-entry table
+// so that the parser never has to consult a locale.
+enum char_class : unsigned short {
+  alpha_char = 0x0001,
+  digit_char = 0x0002,
+  hexdig_char = 0x0004,
+  unreserved_char = 0x0008,
+  sub_delim_char = 0x0010,
+  // unreserved / sub-delims / ":" / "@", i.e. pchar without pct-encoded
+  pchar_char = 0x0020,
+  // pchar / "/"
+  path_char = 0x0040,
+  // pchar / "/" / "?", which is the same for the query and the fragment
+  query_char = 0x0080,
+  // ALPHA / DIGIT / "+" / "-" / "."
+  scheme_char = 0x0100,
+  // unreserved / sub-delims / ":"
+  user_info_char = 0x0200,
+};
+
+constexpr bool in_range(unsigned char c, char first, char last) {
+  return (c >= static_cast<unsigned char>(first)) &&
+         (c <= static_cast<unsigned char>(last));
+}
+
+constexpr bool is_one_of(unsigned char c, const char *chars) {
+  return (*chars != '\0') &&
+         ((static_cast<unsigned char>(*chars) == c) || is_one_of(c, chars + 1));
+}
+
+constexpr bool is_alpha_char(unsigned char c) {
+  return in_range(c, 'a', 'z') || in_range(c, 'A', 'Z');
+}
+
+constexpr bool is_digit_char(unsigned char c) { return in_range(c, '0', '9'); }
+
+// Whitespace in the "C" locale. None of these character functions
+// depend on the global locale, so they can be called in a loop without
+// copying it.
+constexpr bool is_space_char(unsigned char c) {
+  return (c == ' ') || in_range(c, '\t', '\r');
+}
+
+constexpr char to_lower_char(char c) {
+  return in_range(static_cast<unsigned char>(c), 'A', 'Z')
+             ? static_cast<char>(c - 'A' + 'a')
+             : c;
+}
+
+constexpr char to_upper_char(char c) {
+  return in_range(static_cast<unsigned char>(c), 'a', 'z')
+             ? static_cast<char>(c - 'a' + 'A')
+             : c;
+}
+
+constexpr bool is_unreserved_char(unsigned char c) {
+  return is_alpha_char(c) || is_digit_char(c) || is_one_of(c, "-._~");
+}
+
+constexpr bool is_sub_delim_char(unsigned char c) {
+  return is_one_of(c, "!$&'()*+,;=");
+}
+
+constexpr bool is_pchar_char(unsigned char c) {
+  return is_unreserved_char(c) || is_sub_delim_char(c) || is_one_of(c, ":@");
+}
+
+constexpr unsigned short classify(unsigned char c) {
+  // clang-format off
+  return static_cast<unsigned short>(
+      (is_alpha_char(c) ? alpha_char : 0) |
+      (is_digit_char(c) ? digit_char : 0) |
+      ((is_digit_char(c) || in_range(c, 'a', 'f') || in_range(c, 'A', 'F'))
+           ? hexdig_char : 0) |
+      (is_unreserved_char(c) ? unreserved_char : 0) |
+      (is_sub_delim_char(c) ? sub_delim_char : 0) |
+      (is_pchar_char(c) ? pchar_char : 0) |
+      ((is_pchar_char(c) || (c == '/')) ? path_char : 0) |
+      ((is_pchar_char(c) || is_one_of(c, "/?")) ? query_char : 0) |
+      ((is_alpha_char(c) || is_digit_char(c) || is_one_of(c, "+-."))
+           ? scheme_char : 0) |
+      ((is_unreserved_char(c) || is_sub_delim_char(c) || (c == ':'))
+           ? user_info_char : 0));
+  // clang-format on
+}
+
+template <std::size_t... Indices>
+struct index_list {};
+
+template <std::size_t N, std::size_t... Indices>
+struct make_index_list : make_index_list<N - 1, N - 1, Indices...> {};
+
+template <std::size_t... Indices>
+struct make_index_list<0, Indices...> {
+  typedef index_list<Indices...> type;
+};
+
+template <class Indices>
+struct char_class_table;
+
+template <std::size_t... Indices>
+struct char_class_table<index_list<Indices...> > {
+  static constexpr unsigned short value[sizeof...(Indices)] = {
+      classify(static_cast<unsigned char>(Indices))...};
+};
+
+template <std::size_t... Indices>
+constexpr unsigned short
+    char_class_table<index_list<Indices...> >::value[sizeof...(Indices)];
+
+typedef char_class_table<make_index_list<256>::type> char_classes;
+
+constexpr bool is_char_class(char c, unsigned short classes) {
+  return (char_classes::value[static_cast<unsigned char>(c)] & classes) != 0;
+}
+
+inline bool consume_if(string_view::const_iterator &it,
+                       string_view::const_iterator last,
+                       unsigned short classes) {
+  if ((it != last) && is_char_class(*it, classes)) {
+    ++it;
+    return true;
+  }
+  return false;
+}
+
+inline bool isalnum(string_view::const_iterator &it,
+                    string_view::const_iterator last) {
+  return consume_if(it, last, alpha_char | digit_char);
+}
+
+inline bool isdigit(string_view::const_iterator &it,
+                    string_view::const_iterator last) {
+  return consume_if(it, last, digit_char);
+}
+
+inline bool is_sub_delim(string_view::const_iterator &it,
+                         string_view::const_iterator last) {
+  return consume_if(it, last, sub_delim_char);
+}
+
+inline bool is_ucschar(string_view::const_iterator & /*it*/,
+                       string_view::const_iterator /*last*/) {
+  return false;
+}
+
+inline bool is_private(string_view::const_iterator & /*it*/,
+                       string_view::const_iterator /*last*/) {
+  return false;
+}
+
+inline bool is_unreserved(string_view::const_iterator &it,
+                          string_view::const_iterator last) {
+  return consume_if(it, last, unreserved_char);
+}
+
+inline bool is_pct_encoded(string_view::const_iterator &it,
+                           string_view::const_iterator last) {
+  if ((last - it < 3) || (*it != '%')) {
+    return false;
+  }
+
+  if (is_char_class(it[1], hexdig_char) && is_char_class(it[2], hexdig_char)) {
+    it += 3;
+    return true;
+  }
+
+  return false;
+}
+
+// Each of these matches a single character from the given class, or
+// a pct-encoded triplet.
+inline bool is_pchar(string_view::const_iterator &it,
+                     string_view::const_iterator last) {
+  return consume_if(it, last, pchar_char) || is_pct_encoded(it, last) ||
+         is_ucschar(it, last);
+}
+
+inline bool is_path_char(string_view::const_iterator &it,
+                         string_view::const_iterator last) {
+  return consume_if(it, last, path_char) || is_pct_encoded(it, last) ||
+         is_ucschar(it, last);
+}
+
+inline bool is_query_char(string_view::const_iterator &it,
+                          string_view::const_iterator last) {
+  return consume_if(it, last, query_char) || is_pct_encoded(it, last) ||
+         is_ucschar(it, last);
+}
+
+inline bool is_user_info_char(string_view::const_iterator &it,
+                              string_view::const_iterator last) {
+  return consume_if(it, last, user_info_char) || is_pct_encoded(it, last);
+}
+
+// Reads a port number one character at a time, in the same way as
+// std::strtoul, but without reading past the end of the port.
+class port_number {
+ public:
+  constexpr port_number() noexcept
+      : state_(state::space), negative_(false), overflow_(false), value_(0) {}
+
+  NETWORK_URI_CXX14_CONSTEXPR void reset() noexcept {
+    state_ = state::space;
+    negative_ = false;
+    overflow_ = false;
+    value_ = 0;
+  }
+
+  NETWORK_URI_CXX14_CONSTEXPR void consume(char c) noexcept {
+    if ((state_ == state::space) && is_space_char(c)) {
+      return;
+    } else if ((state_ == state::space) && ((c == '+') || (c == '-'))) {
+      negative_ = (c == '-');
+      state_ = state::sign;
+    } else if ((state_ != state::end) && is_char_class(c, digit_char)) {
+      const unsigned long digit = static_cast<unsigned long>(c - '0');
+      if (value_ > (std::numeric_limits<unsigned long>::max() - digit) / 10) {
+        overflow_ = true;
+      } else {
+        value_ = (value_ * 10) + digit;
+      }
+      state_ = state::digits;
+    } else {
+      state_ = state::end;
+    }
+  }
+
+  NETWORK_URI_CXX14_CONSTEXPR bool is_valid() const noexcept {
+    unsigned long value = std::numeric_limits<unsigned long>::max();
+    if (!overflow_) {
+      value = negative_ ? (0ul - value_) : value_;
+    }
+    return (value < std::numeric_limits<unsigned short>::max());
+  }
+
+ private:
+  enum class state { space, sign, digits, end };
+
+  state state_;
+  bool negative_;
+  bool overflow_;
+  unsigned long value_;
+};
+
+inline bool is_valid_port(string_view::const_iterator first,
+                          string_view::const_iterator last) {
+  port_number port;
+  while (first != last) {
+    port.consume(*first);
+    ++first;
+  }
+  return port.is_valid();
+}
+}  // namespace detail
+}  // namespace network
+
+#endif  // NETWORK_DETAIL_URI_GRAMMAR_INC
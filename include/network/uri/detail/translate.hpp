@@ -7,6 +7,7 @@
 #define NETWORK_URI_DETAIL_TRANSLATE_INC
 
 #include <string>
+#include <network/string_view.hpp>
 
 namespace network {
 namespace detail {
@@ -18,6 +19,13 @@ struct translate_impl<std::string> {
   std::string operator()(const std::string &source) const { return source; }
 };
 
+template <>
+struct translate_impl<string_view> {
+  std::string operator()(string_view source) const {
+    return source.to_string();
+  }
+};
+
 template <int N>
 struct translate_impl<char[N]> {
   std::string operator()(const char *source) const { return source; }
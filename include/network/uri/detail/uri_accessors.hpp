@@ -0,0 +1,318 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NETWORK_DETAIL_URI_ACCESSORS_INC
+#define NETWORK_DETAIL_URI_ACCESSORS_INC
+
+#include <cassert>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <network/string_view.hpp>
+#include <network/uri/uri.hpp>
+#include <network/uri/uri_view.hpp>
+#include <network/uri/uri_parse_result.hpp>
+#include <network/uri/detail/uri_parts.hpp>
+#include <network/uri/detail/uri_hash.hpp>
+
+namespace network {
+namespace detail {
+/**
+ * \brief The accessors of a URI class that owns its string, whatever
+ *        the storage.
+ *
+ * Derived provides uri_data(), uri_size() and uri_parts(), and makes
+ * this class a friend.
+ */
+template <class Derived>
+class uri_accessors {
+ public:
+  /**
+   * \brief A reference to the underlying string_type parts.
+   */
+  typedef network::string_view string_view;
+
+  /**
+   * \brief The char traits.
+   */
+  typedef string_view::traits_type traits_type;
+
+  /**
+   * \brief The URI const_iterator type.
+   */
+  typedef string_view::const_iterator const_iterator;
+
+  /**
+   * \brief The URI iterator type.
+   */
+  typedef const_iterator iterator;
+
+  /**
+   * \brief The URI value_type.
+   */
+  typedef std::iterator_traits<iterator>::value_type value_type;
+
+  /**
+   * \brief An iterator over the key-value pairs in the query.
+   */
+  typedef uri::query_iterator query_iterator;
+
+  /**
+   * \brief Returns an iterator at the first element in the
+   *        underlying sequence.
+   * \return An iterator starting at the first element.
+   */
+  const_iterator begin() const noexcept { return view().begin(); }
+
+  /**
+   * \brief Returns an iterator at the end + 1th element in the
+   *        underlying sequence.
+   * \return An iterator starting at the end + 1th element.
+   */
+  const_iterator end() const noexcept { return view().end(); }
+
+  /**
+   * \brief Tests whether this URI has a scheme component.
+   * \return \c true if the URI has a scheme, \c false otherwise.
+   */
+  bool has_scheme() const noexcept { return has(uri_component::scheme); }
+
+  /**
+   * \brief Returns the URI scheme.
+   * \return The scheme.
+   * \pre has_scheme()
+   */
+  string_view scheme() const noexcept { return get(uri_component::scheme); }
+
+  /**
+   * \brief Tests whether this URI has a user info component.
+   * \return \c true if the URI has a user info, \c false otherwise.
+   */
+  bool has_user_info() const noexcept {
+    return has(uri_component::user_info);
+  }
+
+  /**
+   * \brief Returns the URI user info.
+   * \return The user info.
+   * \pre has_user_info()
+   */
+  string_view user_info() const noexcept {
+    return get(uri_component::user_info);
+  }
+
+  /**
+   * \brief Tests whether this URI has a host component.
+   * \return \c true if the URI has a host, \c false otherwise.
+   */
+  bool has_host() const noexcept { return has(uri_component::host); }
+
+  /**
+   * \brief Returns the URI host.
+   * \return The host.
+   * \pre has_host()
+   */
+  string_view host() const noexcept { return get(uri_component::host); }
+
+  /**
+   * \brief Tests whether this URI has a port component.
+   * \return \c true if the URI has a port, \c false otherwise.
+   */
+  bool has_port() const noexcept { return has(uri_component::port); }
+
+  /**
+   * \brief Returns the URI port.
+   * \return The port.
+   * \pre has_port()
+   */
+  string_view port() const noexcept { return get(uri_component::port); }
+
+  /**
+   * \brief Returns the URI port as an integer.
+   * \return The port number.
+   * \pre has_port()
+   */
+  template <typename intT>
+  intT port(typename std::is_integral<intT>::type * = 0) const {
+    assert(has_port());
+    // the string may not be null terminated, so strtoul can't be used
+    unsigned long value = 0;
+    for (auto c : port()) {
+      value = (value * 10) + static_cast<unsigned long>(c - '0');
+    }
+    return static_cast<intT>(value);
+  }
+
+  /**
+   * \brief Tests whether this URI has a path component.
+   * \return \c true if the URI has a path, \c false otherwise.
+   */
+  bool has_path() const noexcept { return has(uri_component::path); }
+
+  /**
+   * \brief Returns the URI path.
+   * \return The path.
+   * \pre has_path()
+   */
+  string_view path() const noexcept { return get(uri_component::path); }
+
+  /**
+   * \brief Tests whether this URI has a query component.
+   * \return \c true if the URI has a query, \c false otherwise.
+   */
+  bool has_query() const noexcept { return has(uri_component::query); }
+
+  /**
+   * \brief Returns the URI query.
+   * \return The query.
+   * \pre has_query()
+   */
+  string_view query() const noexcept { return get(uri_component::query); }
+
+  /**
+   * \brief Returns an iterator to the first key-value pair in the query
+   *        component.
+   *
+   * \return query_iterator.
+   */
+  query_iterator query_begin() const noexcept {
+    return as_view().query_begin();
+  }
+
+  /**
+   * \brief Returns an iterator to the last key-value pair in the query
+   *        component.
+   *
+   * \return query_iterator.
+   */
+  query_iterator query_end() const noexcept { return query_iterator{}; }
+
+  /**
+   * \brief Tests whether this URI has a fragment component.
+   * \return \c true if the URI has a fragment, \c false otherwise.
+   */
+  bool has_fragment() const noexcept { return has(uri_component::fragment); }
+
+  /**
+   * \brief Returns the URI fragment.
+   * \return The fragment.
+   * \pre has_fragment()
+   */
+  string_view fragment() const noexcept {
+    return get(uri_component::fragment);
+  }
+
+  /**
+   * \brief Tests whether this URI has a valid authority.
+   * \return \c true if the URI has an authority, \c false otherwise.
+   */
+  bool has_authority() const noexcept { return has_host(); }
+
+  /**
+   * \brief Returns the URI authority.
+   * \return The authority.
+   */
+  string_view authority() const noexcept { return as_view().authority(); }
+
+  /**
+   * \brief Returns the URI as a std::string object.
+   * \returns A URI string.
+   */
+  std::string string() const { return view().to_string(); }
+
+  /**
+   * \brief Returns the URI as a string_view object.
+   * \returns A URI string view.
+   */
+  string_view view() const noexcept {
+    return string_view(derived().uri_data(), derived().uri_size());
+  }
+
+  /**
+   * \brief Returns a hash of the URI string.
+   * \returns The hash, which is the same as std::hash.
+   */
+  std::size_t hash() const noexcept { return hash_string(view()); }
+
+  /**
+   * \brief Returns a hash of the URI as if it had been normalized at a
+   *        given level in the comparison ladder, without normalizing
+   *        it.
+   * \param level The comparison level.
+   * \returns The hash, which is the same as uri::hash(level).
+   */
+  std::size_t hash(uri_comparison_level level) const noexcept {
+    return hash_normalized(view(), derived().uri_parts(), level);
+  }
+
+  /**
+   * \brief Returns a uri_view of this URI, which is valid for as long
+   *        as this object is and isn't modified.
+   * \returns A URI view.
+   */
+  uri_view as_view() const noexcept {
+    return uri_view(view(), derived().uri_parts());
+  }
+
+  /**
+   * \brief Checks if the uri object is empty, i.e. it has no parts.
+   * \returns \c true if there are no parts, \c false otherwise.
+   */
+  bool empty() const noexcept { return derived().uri_size() == 0; }
+
+  /**
+   * \brief Checks if the uri is absolute, i.e. it has a scheme.
+   * \returns \c true if it is absolute, \c false if it is relative.
+   */
+  bool is_absolute() const noexcept { return has_scheme(); }
+
+  /**
+   * \brief Checks if the uri is opaque, i.e. if it doesn't have an
+   *        authority.
+   * \returns \c true if it is opaque, \c false if it is hierarchical.
+   */
+  bool is_opaque() const noexcept {
+    return (is_absolute() && !has_authority());
+  }
+
+ protected:
+  uri_accessors() = default;
+  uri_accessors(const uri_accessors &) = default;
+  uri_accessors &operator=(const uri_accessors &) = default;
+  ~uri_accessors() = default;
+
+  // Parses a source the way the uri constructor does, so that a
+  // source that is only whitespace is an empty URI.
+  static bool parse(string_view source, uri_view &view) noexcept {
+    auto result = parse_uri(source);
+    view = result.view();
+    return result || (uri_error::empty_uri == result.error());
+  }
+
+  static const compact_uri_parts &parts_of(const uri_view &view) noexcept {
+    return view.uri_parts_;
+  }
+
+  static const compact_uri_parts &parts_of(const uri &other) noexcept {
+    return other.uri_parts_;
+  }
+
+ private:
+  const Derived &derived() const noexcept {
+    return static_cast<const Derived &>(*this);
+  }
+
+  bool has(uri_component c) const noexcept {
+    return derived().uri_parts().has(c);
+  }
+
+  string_view get(uri_component c) const noexcept {
+    return derived().uri_parts().get(derived().uri_data(), c);
+  }
+};
+}  // namespace detail
+}  // namespace network
+
+#endif  // NETWORK_DETAIL_URI_ACCESSORS_INC
@@ -0,0 +1,116 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NETWORK_DETAIL_URI_ASSEMBLE_INC
+#define NETWORK_DETAIL_URI_ASSEMBLE_INC
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <network/optional.hpp>
+#include <network/uri/uri_errors.hpp>
+#include <network/uri/detail/uri_parts.hpp>
+
+namespace network {
+namespace detail {
+typedef optional<std::string> uri_component_arg;
+
+inline std::size_t assembled_length(const uri_component_arg &part) {
+  return part ? part->size() : 0;
+}
+
+// Joins the components of a URI with their delimiters, appending them
+// to an empty string and recording where each one is. The string is
+// reserved up front so that it is allocated once, which matters for
+// allocators that never free.
+template <class String>
+void assemble_uri(String &uri, compact_uri_parts &parts,
+                  const uri_component_arg &scheme,
+                  const uri_component_arg &user_info,
+                  const uri_component_arg &host,
+                  const uri_component_arg &port,
+                  const uri_component_arg &path,
+                  const uri_component_arg &query,
+                  const uri_component_arg &fragment) {
+  typedef compact_uri_parts::offset_type offset_type;
+
+  // "://", "@", ":", "/", "?" and "#" at most
+  const std::size_t length =
+      assembled_length(scheme) + assembled_length(user_info) +
+      assembled_length(host) + assembled_length(port) +
+      assembled_length(path) + assembled_length(query) +
+      assembled_length(fragment) + 8;
+  if (length > std::numeric_limits<offset_type>::max()) {
+    throw uri_builder_error();
+  }
+  uri.reserve(length);
+
+  // appends a part and records where it is in the URI
+  auto append_part = [&uri, &parts](uri_component component,
+                                    const std::string &part) {
+    const auto first = static_cast<offset_type>(uri.size());
+    uri.append(part.data(), part.size());
+    parts.set(component, first, static_cast<offset_type>(uri.size()));
+  };
+
+  if (scheme) {
+    append_part(uri_component::scheme, *scheme);
+  }
+
+  if (user_info || host || port) {
+    if (scheme) {
+      uri.append("://");
+    }
+
+    if (user_info) {
+      append_part(uri_component::user_info, *user_info);
+      uri.append("@");
+    }
+
+    if (host) {
+      append_part(uri_component::host, *host);
+    } else {
+      throw uri_builder_error();
+    }
+
+    if (port) {
+      uri.append(":");
+      append_part(uri_component::port, *port);
+    }
+  } else {
+    if (scheme) {
+      if (path || query || fragment) {
+        uri.append(":");
+      } else {
+        throw uri_builder_error();
+      }
+    }
+  }
+
+  if (path) {
+    // if the URI is not opaque and the path is not already prefixed
+    // with a '/', add one.
+    const auto first = static_cast<offset_type>(uri.size());
+    if (host && (!path->empty() && path->front() != '/')) {
+      uri.append("/");
+    }
+    uri.append(path->data(), path->size());
+    parts.set(uri_component::path, first, static_cast<offset_type>(uri.size()));
+  }
+
+  if (query) {
+    uri.append("?");
+    append_part(uri_component::query, *query);
+  }
+
+  if (fragment) {
+    uri.append("#");
+    append_part(uri_component::fragment, *fragment);
+  }
+}
+}  // namespace detail
+}  // namespace network
+
+#endif  // NETWORK_DETAIL_URI_ASSEMBLE_INC
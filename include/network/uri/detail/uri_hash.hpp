@@ -0,0 +1,211 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NETWORK_DETAIL_URI_HASH_INC
+#define NETWORK_DETAIL_URI_HASH_INC
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <network/string_view.hpp>
+
+namespace network {
+namespace detail {
+// A hash that reads the string a word at a time, after wyhash, which
+// is in the public domain (https://github.com/wangyi-fudan/wyhash).
+// The value depends on the byte order, so it mustn't be stored.
+namespace hash_impl {
+const std::uint64_t secret0 = 0xa0761d6478bd642full;
+const std::uint64_t secret1 = 0xe7037ed1a0b428dbull;
+const std::uint64_t secret2 = 0x8ebc6af09c88c6e3ull;
+const std::uint64_t secret3 = 0x589965cc75374cc3ull;
+
+// Replaces a and b with the low and high halves of their product.
+inline void multiply(std::uint64_t &a, std::uint64_t &b) noexcept {
+#if defined(__SIZEOF_INT128__)
+  __extension__ typedef unsigned __int128 uint128;
+  uint128 product = a;
+  product *= b;
+  a = static_cast<std::uint64_t>(product);
+  b = static_cast<std::uint64_t>(product >> 64);
+#else
+  const std::uint64_t a_high = a >> 32, b_high = b >> 32;
+  const std::uint64_t a_low = a & 0xffffffffull, b_low = b & 0xffffffffull;
+  const std::uint64_t high = a_high * b_high, middle0 = a_high * b_low,
+                      middle1 = b_high * a_low, low = a_low * b_low;
+  const std::uint64_t t = low + (middle0 << 32);
+  std::uint64_t carry = (t < low) ? 1 : 0;
+  const std::uint64_t result_low = t + (middle1 << 32);
+  carry += (result_low < t) ? 1 : 0;
+  a = result_low;
+  b = high + (middle0 >> 32) + (middle1 >> 32) + carry;
+#endif  // defined(__SIZEOF_INT128__)
+}
+
+inline std::uint64_t mix(std::uint64_t a, std::uint64_t b) noexcept {
+  multiply(a, b);
+  return a ^ b;
+}
+
+inline std::uint64_t read8(const char *p) noexcept {
+  std::uint64_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+inline std::uint64_t read4(const char *p) noexcept {
+  std::uint32_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+inline std::uint64_t read3(const char *p, std::size_t size) noexcept {
+  return (std::uint64_t(static_cast<unsigned char>(p[0])) << 16) |
+         (std::uint64_t(static_cast<unsigned char>(p[size >> 1])) << 8) |
+         std::uint64_t(static_cast<unsigned char>(p[size - 1]));
+}
+
+// Reads a string of no more than 16 bytes into two words.
+inline void read_short(const char *p, std::size_t size, std::uint64_t &a,
+                       std::uint64_t &b) noexcept {
+  if (size >= 4) {
+    const auto shift = (size >> 3) << 2;
+    a = (read4(p) << 32) | read4(p + shift);
+    b = (read4(p + size - 4) << 32) | read4(p + size - 4 - shift);
+  } else if (size > 0) {
+    a = read3(p, size);
+    b = 0;
+  } else {
+    a = 0;
+    b = 0;
+  }
+}
+
+inline std::uint64_t finish(std::uint64_t a, std::uint64_t b,
+                            std::uint64_t seed, std::size_t size) noexcept {
+  a ^= secret1;
+  b ^= seed;
+  multiply(a, b);
+  return mix(a ^ secret0 ^ size, b ^ secret1);
+}
+}  // namespace hash_impl
+
+inline std::uint64_t hash_bytes(const char *p, std::size_t size,
+                                std::uint64_t seed = 0) noexcept {
+  using namespace hash_impl;
+  seed ^= mix(seed ^ secret0, secret1);
+  std::uint64_t a = 0, b = 0;
+  if (size <= 16) {
+    read_short(p, size, a, b);
+  } else {
+    auto remaining = size;
+    if (remaining > 48) {
+      auto seed1 = seed, seed2 = seed;
+      do {
+        seed = mix(read8(p) ^ secret1, read8(p + 8) ^ seed);
+        seed1 = mix(read8(p + 16) ^ secret2, read8(p + 24) ^ seed1);
+        seed2 = mix(read8(p + 32) ^ secret3, read8(p + 40) ^ seed2);
+        p += 48;
+        remaining -= 48;
+      } while (remaining > 48);
+      seed ^= seed1 ^ seed2;
+    }
+    while (remaining > 16) {
+      seed = mix(read8(p) ^ secret1, read8(p + 8) ^ seed);
+      p += 16;
+      remaining -= 16;
+    }
+    a = read8(p + remaining - 16);
+    b = read8(p + remaining - 8);
+  }
+  return finish(a, b, seed, size);
+}
+
+// Computes the same hash as hash_bytes, for a string that is given a
+// piece at a time. A 48 byte block is mixed in once the byte after it
+// arrives, and the last 16 bytes of the block are kept, because the
+// final words can overlap it.
+class incremental_hash {
+ public:
+  explicit incremental_hash(std::uint64_t seed = 0) noexcept
+      : size_(0), pending_(0) {
+    using namespace hash_impl;
+    seed_ = seed ^ mix(seed ^ secret0, secret1);
+    seed1_ = seed_;
+    seed2_ = seed_;
+  }
+
+  void append(char c) noexcept {
+    buffer_[history + pending_] = c;
+    ++pending_;
+    ++size_;
+    if (pending_ > block) {
+      consume();
+    }
+  }
+
+  void append(const char *p, std::size_t size) noexcept {
+    while (size > 0) {
+      const auto count =
+          (size < block + 1 - pending_) ? size : block + 1 - pending_;
+      std::memcpy(buffer_ + history + pending_, p, count);
+      pending_ += count;
+      size_ += count;
+      p += count;
+      size -= count;
+      if (pending_ > block) {
+        consume();
+      }
+    }
+  }
+
+  std::uint64_t finish() const noexcept {
+    using namespace hash_impl;
+    auto seed = seed_;
+    std::uint64_t a = 0, b = 0;
+    const char *p = buffer_ + history;
+    if (size_ <= 16) {
+      read_short(p, size_, a, b);
+    } else {
+      if (size_ > block) {
+        seed ^= seed1_ ^ seed2_;
+      }
+      auto remaining = pending_;
+      while (remaining > 16) {
+        seed = mix(read8(p) ^ secret1, read8(p + 8) ^ seed);
+        p += 16;
+        remaining -= 16;
+      }
+      a = read8(p + remaining - 16);
+      b = read8(p + remaining - 8);
+    }
+    return hash_impl::finish(a, b, seed, size_);
+  }
+
+ private:
+  static const std::size_t history = 16, block = 48;
+
+  void consume() noexcept {
+    using namespace hash_impl;
+    const char *p = buffer_ + history;
+    seed_ = mix(read8(p) ^ secret1, read8(p + 8) ^ seed_);
+    seed1_ = mix(read8(p + 16) ^ secret2, read8(p + 24) ^ seed1_);
+    seed2_ = mix(read8(p + 32) ^ secret3, read8(p + 40) ^ seed2_);
+    std::memmove(buffer_, buffer_ + block, history + 1);
+    pending_ = 1;
+  }
+
+  std::uint64_t seed_, seed1_, seed2_;
+  std::size_t size_, pending_;
+  char buffer_[history + block + 1];
+};
+
+inline std::size_t hash_string(string_view s) noexcept {
+  return static_cast<std::size_t>(hash_bytes(s.data(), s.size()));
+}
+}  // namespace detail
+}  // namespace network
+
+#endif  // NETWORK_DETAIL_URI_HASH_INC
@@ -6,11 +6,14 @@
 #ifndef NETWORK_DETAIL_URI_PARTS_INC
 #define NETWORK_DETAIL_URI_PARTS_INC
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <utility>
 #include <iterator>
 #include <network/optional.hpp>
 #include <network/string_view.hpp>
+#include <network/uri/config.hpp>
 
 namespace network {
 namespace detail {
@@ -82,6 +85,88 @@ struct uri_parts {
     fragment = nullopt;
   }
 };
+
+enum class uri_component : unsigned char {
+  scheme,
+  user_info,
+  host,
+  port,
+  path,
+  query,
+  fragment,
+};
+
+// The parts of a URI stored as offsets into the URI string, with a
+// bit mask to say which of them are present. Unlike uri_parts, this
+// doesn't depend on where the string is, so it stays valid when the
+// string is copied, moved or swapped.
+class compact_uri_parts {
+ public:
+  typedef std::uint32_t offset_type;
+
+  static const std::size_t component_count = 7;
+
+  constexpr compact_uri_parts() noexcept : offsets_(), present_(0) {}
+
+  compact_uri_parts(string_view::const_iterator base,
+                    const uri_parts &parts) noexcept
+      : compact_uri_parts() {
+    set(uri_component::scheme, base, parts.scheme);
+    set(uri_component::user_info, base, parts.hier_part.user_info);
+    set(uri_component::host, base, parts.hier_part.host);
+    set(uri_component::port, base, parts.hier_part.port);
+    set(uri_component::path, base, parts.hier_part.path);
+    set(uri_component::query, base, parts.query);
+    set(uri_component::fragment, base, parts.fragment);
+  }
+
+  constexpr bool has(uri_component c) const noexcept {
+    return (present_ & mask(c)) != 0;
+  }
+
+  constexpr offset_type first(uri_component c) const noexcept {
+    return offsets_[index(c)];
+  }
+
+  constexpr offset_type last(uri_component c) const noexcept {
+    return offsets_[index(c) + 1];
+  }
+
+  constexpr string_view get(const char *base, uri_component c) const
+      noexcept {
+    return has(c) ? string_view(base + first(c), last(c) - first(c))
+                  : string_view();
+  }
+
+  NETWORK_URI_CXX14_CONSTEXPR void set(uri_component c, offset_type first,
+                                       offset_type last) noexcept {
+    offsets_[index(c)] = first;
+    offsets_[index(c) + 1] = last;
+    present_ |= mask(c);
+  }
+
+  void set(uri_component c, string_view::const_iterator base,
+           const optional<uri_part> &part) noexcept {
+    if (part) {
+      set(c, static_cast<offset_type>(std::begin(*part) - base),
+          static_cast<offset_type>(std::end(*part) - base));
+    }
+  }
+
+  NETWORK_URI_CXX14_CONSTEXPR void clear() noexcept { present_ = 0; }
+
+ private:
+  static constexpr std::size_t index(uri_component c) noexcept {
+    return 2 * static_cast<std::size_t>(c);
+  }
+
+  static constexpr std::uint8_t mask(uri_component c) noexcept {
+    return static_cast<std::uint8_t>(1u << static_cast<unsigned>(c));
+  }
+
+  offset_type offsets_[2 * component_count];
+  std::uint8_t present_;
+};
 }  // namespace detail
 }  // namespace network
 
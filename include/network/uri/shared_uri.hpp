@@ -0,0 +1,457 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NETWORK_URI_SHARED_URI_INC
+#define NETWORK_URI_SHARED_URI_INC
+
+/**
+ * \file
+ * \brief Contains the shared_uri and local_shared_uri classes.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <system_error>
+#include <utility>
+#include <network/string_view.hpp>
+#include <network/uri/config.hpp>
+#include <network/uri/uri.hpp>
+#include <network/uri/uri_view.hpp>
+#include <network/uri/detail/uri_accessors.hpp>
+#include <network/uri/detail/uri_parts.hpp>
+#include <network/uri/detail/uri_hash.hpp>
+
+#ifdef NETWORK_URI_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4251 4231 4660)
+#endif
+
+namespace network {
+namespace detail {
+// A reference count that can be shared between threads.
+class atomic_ref_count {
+ public:
+  atomic_ref_count() noexcept : count_(1) {}
+
+  void increment() noexcept { count_.fetch_add(1, std::memory_order_relaxed); }
+
+  // Returns true when the last reference is released.
+  bool decrement() noexcept {
+    return count_.fetch_sub(1, std::memory_order_acq_rel) == 1;
+  }
+
+  std::size_t count() const noexcept {
+    return count_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<std::uint32_t> count_;
+};
+
+// A reference count for objects that are only used on one thread.
+class local_ref_count {
+ public:
+  local_ref_count() noexcept : count_(1) {}
+
+  void increment() noexcept { ++count_; }
+
+  bool decrement() noexcept { return --count_ == 0; }
+
+  std::size_t count() const noexcept { return count_; }
+
+ private:
+  std::uint32_t count_;
+};
+}  // namespace detail
+
+/**
+ * \ingroup uri
+ * \class basic_shared_uri network/uri/shared_uri.hpp network/uri.hpp
+ * \brief A class that parses a URI into its component parts, and
+ *        shares them between its copies.
+ *
+ * The string and the component offsets are kept together in one
+ * reference counted block, which is never modified after it is
+ * created. Copying a basic_shared_uri increments the count, so it
+ * costs the same however long the URI is. An empty URI doesn't
+ * allocate.
+ *
+ * network::shared_uri counts references atomically, so its copies can
+ * be used on different threads. network::local_shared_uri doesn't,
+ * which is cheaper when all the copies stay on one thread.
+ *
+ * Example:
+ *
+ * \code
+ * network::shared_uri instance("http://cpp-netlib.org/");
+ * auto copy = instance;
+ * assert(copy.view().data() == instance.view().data());
+ * assert(2 == instance.use_count());
+ * \endcode
+ *
+ * normalize, resolve, make_relative and compare use a temporary uri.
+ *
+ * \sa uri
+ */
+template <class RefCount>
+class basic_shared_uri
+    : public detail::uri_accessors<basic_shared_uri<RefCount>> {
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+  friend class detail::uri_accessors<basic_shared_uri>;
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+ public:
+  /**
+   * \brief Default constructor.
+   */
+  basic_shared_uri() noexcept : block_(nullptr) {}
+
+  /**
+   * \brief Constructor.
+   * \param source A string that is to be parsed as a URI. Leading
+   *        and trailing whitespace is ignored.
+   * \throws uri_syntax_error if the source is not a valid URI.
+   * \throws std::bad_alloc If the block cannot be allocated.
+   */
+  explicit basic_shared_uri(string_view source) : block_(nullptr) {
+    if (!initialize(source)) {
+      throw uri_syntax_error();
+    }
+  }
+
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+  basic_shared_uri(string_view source, std::error_code &ec) : block_(nullptr) {
+    if (!initialize(source)) {
+      ec = make_error_code(uri_error::invalid_syntax);
+    }
+  }
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+  /**
+   * \brief Constructor.
+   * \param view A URI that has already been parsed. The string is
+   *        copied but it isn't parsed again.
+   * \throws std::bad_alloc If the block cannot be allocated.
+   */
+  explicit basic_shared_uri(const uri_view &view)
+      : block_(make_block(view.view(), base_type::parts_of(view))) {}
+
+  /**
+   * \brief Constructor.
+   * \param other A uri. The string is copied but it isn't parsed
+   *        again.
+   * \throws std::bad_alloc If the block cannot be allocated.
+   */
+  explicit basic_shared_uri(const uri &other)
+      : block_(make_block(other.view(), base_type::parts_of(other))) {}
+
+  /**
+   * \brief Copy constructor. The copy shares the string.
+   */
+  basic_shared_uri(const basic_shared_uri &other) noexcept
+      : block_(other.block_) {
+    if (block_) {
+      block_->refs.increment();
+    }
+  }
+
+  /**
+   * \brief Move constructor.
+   */
+  basic_shared_uri(basic_shared_uri &&other) noexcept : block_(other.block_) {
+    other.block_ = nullptr;
+  }
+
+  /**
+   * \brief Destructor.
+   */
+  ~basic_shared_uri() { release(); }
+
+  /**
+   * \brief Assignment operator.
+   */
+  basic_shared_uri &operator=(basic_shared_uri other) noexcept {
+    other.swap(*this);
+    return *this;
+  }
+
+  /**
+   * \brief Swaps one basic_shared_uri object with another.
+   * \param other The other basic_shared_uri object.
+   */
+  void swap(basic_shared_uri &other) noexcept {
+    std::swap(block_, other.block_);
+  }
+
+  /**
+   * \brief Returns the number of objects that share this URI.
+   * \returns The number of objects, or \c 0 if this is empty.
+   */
+  std::size_t use_count() const noexcept {
+    return block_ ? block_->refs.count() : 0;
+  }
+
+  /**
+   * \brief Returns a hash of the URI string, which is computed once,
+   *        when the URI is constructed.
+   * \returns The hash, which is the same as std::hash.
+   */
+  std::size_t hash() const noexcept {
+    return block_ ? block_->hash : detail::hash_string(string_view());
+  }
+
+  /**
+   * \brief Returns a hash of the URI as if it had been normalized at a
+   *        given level in the comparison ladder, without normalizing
+   *        it.
+   * \param level The comparison level.
+   * \returns The hash, which is the same as uri::hash(level).
+   */
+  std::size_t hash(uri_comparison_level level) const noexcept {
+    if (uri_comparison_level::string_comparison == level) {
+      return hash();
+    }
+    return base_type::hash(level);
+  }
+
+  /**
+   * \brief Normalizes a uri object at a given level in the
+   *        comparison ladder.
+   * \param level The comparison level.
+   * \returns A normalized uri.
+   * \post compare(normalize(uri, level), level) == 0
+   * \throws uri_builder_error if the path has a ".." segment with
+   *         nothing to remove.
+   * \throws std::bad_alloc
+   */
+  basic_shared_uri normalize(uri_comparison_level level) const {
+    return basic_shared_uri(uri(this->as_view()).normalize(level));
+  }
+
+  /**
+   * \brief Returns a relative reference against the base URI.
+   * \param base The base URI.
+   * \returns A relative reference of this URI against the base.
+   * \throws std::bad_alloc
+   */
+  basic_shared_uri make_relative(const basic_shared_uri &base) const {
+    return basic_shared_uri(
+        uri(this->as_view()).make_relative(uri(base.as_view())));
+  }
+
+  /**
+   * \brief Resolves a relative reference against the given URI.
+   * \param base The base URI to resolve against.
+   * \returns An absolute URI.
+   * \throws std::bad_alloc
+   */
+  basic_shared_uri resolve(const basic_shared_uri &base) const {
+    return basic_shared_uri(uri(this->as_view()).resolve(uri(base.as_view())));
+  }
+
+  /**
+   * \brief Compares this URI against another, corresponding to the
+   *        level in the comparison ladder.
+   * \param other The other URI.
+   * \param level The level in the comparison ladder.
+   * \returns \c 0 if the URIs are considered equal, \c -1 if this is
+   *         less than other and and 1 if this is greater than
+   *         other.
+   */
+  int compare(const basic_shared_uri &other,
+              uri_comparison_level level) const noexcept {
+    if (block_ == other.block_) {
+      return 0;
+    }
+    return detail::compare_normalized(this->view(), uri_parts(), other.view(),
+                                      other.uri_parts(), level);
+  }
+
+ private:
+  typedef detail::uri_accessors<basic_shared_uri> base_type;
+
+  // The string follows the block in the same allocation.
+  struct block {
+    block(string_view text, const detail::compact_uri_parts &parts) noexcept
+        : refs(),
+          size(static_cast<std::uint32_t>(text.size())),
+          parts(parts),
+          hash(detail::hash_string(text)) {}
+
+    const char *data() const noexcept {
+      return reinterpret_cast<const char *>(this + 1);
+    }
+
+    RefCount refs;
+    std::uint32_t size;
+    detail::compact_uri_parts parts;
+    std::size_t hash;
+  };
+
+  static block *make_block(string_view text,
+                           const detail::compact_uri_parts &parts) {
+    if (text.empty()) {
+      return nullptr;
+    }
+
+    void *memory = ::operator new(sizeof(block) + text.size());
+    auto result = ::new (memory) block(text, parts);
+    std::memcpy(static_cast<char *>(memory) + sizeof(block), text.data(),
+                text.size());
+    return result;
+  }
+
+  bool initialize(string_view source) {
+    uri_view view;
+    if (!base_type::parse(source, view)) {
+      return false;
+    }
+    block_ = make_block(view.view(), base_type::parts_of(view));
+    return true;
+  }
+
+  void release() noexcept {
+    if (block_ && block_->refs.decrement()) {
+      destroy(block_);
+    }
+    block_ = nullptr;
+  }
+
+  // GCC 12 inlines the release of both copies of a block and can't
+  // tell that only the last one frees it, so it warns about a use after
+  // free (-Wuse-after-free). Freeing the block out of line hides that.
+  static NETWORK_URI_NOINLINE void destroy(block *b) noexcept {
+    b->~block();
+    ::operator delete(b);
+  }
+
+  const char *uri_data() const noexcept {
+    return block_ ? block_->data() : nullptr;
+  }
+
+  std::size_t uri_size() const noexcept { return block_ ? block_->size : 0; }
+
+  const detail::compact_uri_parts &uri_parts() const noexcept {
+    static const detail::compact_uri_parts empty_parts;
+    return block_ ? block_->parts : empty_parts;
+  }
+
+  block *block_;
+};
+
+/**
+ * \brief A URI whose copies share its string, and can be used on
+ *        different threads.
+ */
+typedef basic_shared_uri<detail::atomic_ref_count> shared_uri;
+
+/**
+ * \brief A URI whose copies share its string, and are all used on
+ *        the same thread.
+ */
+typedef basic_shared_uri<detail::local_ref_count> local_shared_uri;
+
+/**
+ * \brief Swaps one basic_shared_uri object with another.
+ */
+template <class RefCount>
+inline void swap(basic_shared_uri<RefCount> &lhs,
+                 basic_shared_uri<RefCount> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+/**
+ * \brief Equality operator for the \c basic_shared_uri.
+ */
+template <class RefCount>
+inline bool operator==(const basic_shared_uri<RefCount> &lhs,
+                       const basic_shared_uri<RefCount> &rhs) noexcept {
+  return lhs.view() == rhs.view();
+}
+
+/**
+ * \brief Equality operator for the \c basic_shared_uri.
+ */
+template <class RefCount>
+inline bool operator==(const basic_shared_uri<RefCount> &lhs,
+                       const char *rhs) noexcept {
+  return lhs.view() == string_view{rhs};
+}
+
+/**
+ * \brief Equality operator for the \c basic_shared_uri.
+ */
+template <class RefCount>
+inline bool operator==(const char *lhs,
+                       const basic_shared_uri<RefCount> &rhs) noexcept {
+  return rhs == lhs;
+}
+
+/**
+ * \brief Inequality operator for the \c basic_shared_uri.
+ */
+template <class RefCount>
+inline bool operator!=(const basic_shared_uri<RefCount> &lhs,
+                       const basic_shared_uri<RefCount> &rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+/**
+ * \brief Less-than operator for the \c basic_shared_uri.
+ */
+template <class RefCount>
+inline bool operator<(const basic_shared_uri<RefCount> &lhs,
+                      const basic_shared_uri<RefCount> &rhs) noexcept {
+  return lhs.view() < rhs.view();
+}
+
+/**
+ * \brief Greater-than operator for the \c basic_shared_uri.
+ */
+template <class RefCount>
+inline bool operator>(const basic_shared_uri<RefCount> &lhs,
+                      const basic_shared_uri<RefCount> &rhs) noexcept {
+  return rhs < lhs;
+}
+
+/**
+ * \brief Less-than-or-equal-to operator for the \c basic_shared_uri.
+ */
+template <class RefCount>
+inline bool operator<=(const basic_shared_uri<RefCount> &lhs,
+                       const basic_shared_uri<RefCount> &rhs) noexcept {
+  return !(rhs < lhs);
+}
+
+/**
+ * \brief Greater-than-or-equal-to operator for the \c basic_shared_uri.
+ */
+template <class RefCount>
+inline bool operator>=(const basic_shared_uri<RefCount> &lhs,
+                       const basic_shared_uri<RefCount> &rhs) noexcept {
+  return !(lhs < rhs);
+}
+}  // namespace network
+
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+namespace std {
+template <class RefCount>
+struct hash<network::basic_shared_uri<RefCount>> {
+  std::size_t operator()(
+      const network::basic_shared_uri<RefCount> &uri_) const noexcept {
+    return uri_.hash();
+  }
+};
+}  // namespace std
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+#ifdef NETWORK_URI_MSVC
+#pragma warning(pop)
+#endif
+
+#endif  // NETWORK_URI_SHARED_URI_INC
@@ -0,0 +1,403 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NETWORK_URI_SMALL_URI_INC
+#define NETWORK_URI_SMALL_URI_INC
+
+/**
+ * \file
+ * \brief Contains the small_uri class template.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+#include <utility>
+#include <network/string_view.hpp>
+#include <network/uri/config.hpp>
+#include <network/uri/uri.hpp>
+#include <network/uri/uri_view.hpp>
+#include <network/uri/detail/uri_accessors.hpp>
+#include <network/uri/detail/uri_parts.hpp>
+
+#ifdef NETWORK_URI_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4251 4231 4660)
+#endif
+
+namespace network {
+/**
+ * \ingroup uri
+ * \class small_uri network/uri/small_uri.hpp network/uri.hpp
+ * \brief A class that parses a URI into its component parts, and
+ *        keeps a short URI inside the object.
+ *
+ * A URI that is no longer than \c InlineCapacity is stored inline, so
+ * constructing or copying it doesn't allocate, and reading a
+ * component doesn't follow a pointer to the heap. A longer URI is
+ * stored on the heap, like the uri. The components are stored as
+ * offsets, so a copy doesn't need to find them again.
+ *
+ * The object is \c InlineCapacity bytes plus 64, so the offsets are
+ * in the first cache line and a short URI follows them. It is best
+ * kept in a contiguous container.
+ *
+ * Example:
+ *
+ * \code
+ * std::vector<network::small_uri<128>> uris;
+ * uris.emplace_back("http://cpp-netlib.org/");
+ * assert(uris.front().is_inline());
+ * \endcode
+ *
+ * normalize, resolve, make_relative and compare use a temporary uri.
+ *
+ * \sa uri
+ */
+template <std::size_t InlineCapacity = 128>
+class small_uri : public detail::uri_accessors<small_uri<InlineCapacity>> {
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+  friend class detail::uri_accessors<small_uri>;
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+  static_assert(InlineCapacity >= sizeof(char *),
+                "The inline capacity must be able to hold a pointer.");
+
+ public:
+  /**
+   * \brief The size of the longest URI that is stored inline.
+   */
+  static constexpr std::size_t inline_capacity = InlineCapacity;
+
+  /**
+   * \brief Default constructor.
+   */
+  small_uri() noexcept : size_(0), uri_parts_() {}
+
+  /**
+   * \brief Constructor.
+   * \param source A string that is to be parsed as a URI. Leading
+   *        and trailing whitespace is ignored.
+   * \throws uri_syntax_error if the source is not a valid URI.
+   * \throws std::bad_alloc If the URI is too long to be stored inline
+   *         and cannot be allocated.
+   */
+  explicit small_uri(string_view source) : size_(0), uri_parts_() {
+    if (!initialize(source)) {
+      throw uri_syntax_error();
+    }
+  }
+
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+  small_uri(string_view source, std::error_code &ec) : size_(0), uri_parts_() {
+    if (!initialize(source)) {
+      ec = make_error_code(uri_error::invalid_syntax);
+    }
+  }
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+  /**
+   * \brief Constructor.
+   * \param view A URI that has already been parsed. The string is
+   *        copied but it isn't parsed again.
+   * \throws std::bad_alloc If the URI is too long to be stored inline
+   *         and cannot be allocated.
+   */
+  explicit small_uri(const uri_view &view) : size_(0), uri_parts_() {
+    assign(view.view(), base_type::parts_of(view));
+  }
+
+  /**
+   * \brief Constructor.
+   * \param other A uri. The string is copied but it isn't parsed
+   *        again.
+   * \throws std::bad_alloc If the URI is too long to be stored inline
+   *         and cannot be allocated.
+   */
+  explicit small_uri(const uri &other) : size_(0), uri_parts_() {
+    assign(other.view(), base_type::parts_of(other));
+  }
+
+  /**
+   * \brief Copy constructor.
+   * \throws std::bad_alloc If the URI is too long to be stored inline
+   *         and cannot be allocated.
+   */
+  small_uri(const small_uri &other) : size_(0), uri_parts_() {
+    assign(other.view(), other.uri_parts_);
+  }
+
+  /**
+   * \brief Move constructor.
+   */
+  small_uri(small_uri &&other) noexcept : size_(0), uri_parts_() {
+    steal(other);
+  }
+
+  /**
+   * \brief Destructor.
+   */
+  ~small_uri() { release(); }
+
+  /**
+   * \brief Copy assignment operator.
+   * \throws std::bad_alloc If the URI is too long to be stored inline
+   *         and cannot be allocated.
+   */
+  small_uri &operator=(const small_uri &other) {
+    if (this != &other) {
+      small_uri copy(other);
+      release();
+      steal(copy);
+    }
+    return *this;
+  }
+
+  /**
+   * \brief Move assignment operator.
+   */
+  small_uri &operator=(small_uri &&other) noexcept {
+    if (this != &other) {
+      release();
+      steal(other);
+    }
+    return *this;
+  }
+
+  /**
+   * \brief Swaps one small_uri object with another.
+   * \param other The other small_uri object.
+   */
+  void swap(small_uri &other) noexcept {
+    small_uri tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+  /**
+   * \brief Tests whether the URI is stored inside the object.
+   * \returns \c true if the URI is stored inline, \c false if it is
+   *          on the heap.
+   */
+  bool is_inline() const noexcept { return size_ <= InlineCapacity; }
+
+  /**
+   * \brief Normalizes a uri object at a given level in the
+   *        comparison ladder.
+   * \param level The comparison level.
+   * \returns A normalized uri.
+   * \post compare(normalize(uri, level), level) == 0
+   * \throws uri_builder_error if the path has a ".." segment with
+   *         nothing to remove.
+   * \throws std::bad_alloc
+   */
+  small_uri normalize(uri_comparison_level level) const {
+    return small_uri(uri(this->as_view()).normalize(level));
+  }
+
+  /**
+   * \brief Returns a relative reference against the base URI.
+   * \param base The base URI.
+   * \returns A relative reference of this URI against the base.
+   * \throws std::bad_alloc
+   */
+  small_uri make_relative(const small_uri &base) const {
+    return small_uri(uri(this->as_view()).make_relative(uri(base.as_view())));
+  }
+
+  /**
+   * \brief Resolves a relative reference against the given URI.
+   * \param base The base URI to resolve against.
+   * \returns An absolute URI.
+   * \throws std::bad_alloc
+   */
+  small_uri resolve(const small_uri &base) const {
+    return small_uri(uri(this->as_view()).resolve(uri(base.as_view())));
+  }
+
+  /**
+   * \brief Compares this URI against another, corresponding to the
+   *        level in the comparison ladder.
+   * \param other The other URI.
+   * \param level The level in the comparison ladder.
+   * \returns \c 0 if the URIs are considered equal, \c -1 if this is
+   *         less than other and and 1 if this is greater than
+   *         other.
+   */
+  int compare(const small_uri &other, uri_comparison_level level) const
+      noexcept {
+    return detail::compare_normalized(this->view(), uri_parts(), other.view(),
+                                      other.uri_parts(), level);
+  }
+
+ private:
+  typedef detail::uri_accessors<small_uri> base_type;
+
+  bool initialize(string_view source) {
+    uri_view view;
+    if (!base_type::parse(source, view)) {
+      return false;
+    }
+    assign(view.view(), base_type::parts_of(view));
+    return true;
+  }
+
+  // Copies a URI into an empty object.
+  void assign(string_view text, const detail::compact_uri_parts &parts) {
+    char *data = storage_.inline_;
+    if (text.size() > InlineCapacity) {
+      data = new char[text.size()];
+      storage_.heap_ = data;
+    }
+    if (!text.empty()) {
+      std::memcpy(data, text.data(), text.size());
+    }
+    size_ = static_cast<std::uint32_t>(text.size());
+    uri_parts_ = parts;
+  }
+
+  // Moves a URI into an empty object, and leaves the other empty.
+  void steal(small_uri &other) noexcept {
+    if (other.is_inline()) {
+      std::memcpy(storage_.inline_, other.storage_.inline_, other.size_);
+    } else {
+      storage_.heap_ = other.storage_.heap_;
+    }
+    size_ = other.size_;
+    uri_parts_ = other.uri_parts_;
+    other.size_ = 0;
+    other.uri_parts_.clear();
+  }
+
+  void release() noexcept {
+    if (!is_inline()) {
+      delete[] storage_.heap_;
+    }
+    size_ = 0;
+    uri_parts_.clear();
+  }
+
+  const char *uri_data() const noexcept {
+    return is_inline() ? storage_.inline_ : storage_.heap_;
+  }
+
+  std::size_t uri_size() const noexcept { return size_; }
+
+  const detail::compact_uri_parts &uri_parts() const noexcept {
+    return uri_parts_;
+  }
+
+  // the offsets fill the first cache line, and are followed by the URI
+  std::uint32_t size_;
+  detail::compact_uri_parts uri_parts_;
+  union {
+    char inline_[InlineCapacity];
+    char *heap_;
+  } storage_;
+};
+
+template <std::size_t InlineCapacity>
+constexpr std::size_t small_uri<InlineCapacity>::inline_capacity;
+
+/**
+ * \brief Swaps one small_uri object with another.
+ */
+template <std::size_t InlineCapacity>
+inline void swap(small_uri<InlineCapacity> &lhs,
+                 small_uri<InlineCapacity> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+/**
+ * \brief Equality operator for the \c small_uri.
+ */
+template <std::size_t InlineCapacity>
+inline bool operator==(const small_uri<InlineCapacity> &lhs,
+                       const small_uri<InlineCapacity> &rhs) noexcept {
+  return lhs.view() == rhs.view();
+}
+
+/**
+ * \brief Equality operator for the \c small_uri.
+ */
+template <std::size_t InlineCapacity>
+inline bool operator==(const small_uri<InlineCapacity> &lhs,
+                       const char *rhs) noexcept {
+  return lhs.view() == string_view{rhs};
+}
+
+/**
+ * \brief Equality operator for the \c small_uri.
+ */
+template <std::size_t InlineCapacity>
+inline bool operator==(const char *lhs,
+                       const small_uri<InlineCapacity> &rhs) noexcept {
+  return rhs == lhs;
+}
+
+/**
+ * \brief Inequality operator for the \c small_uri.
+ */
+template <std::size_t InlineCapacity>
+inline bool operator!=(const small_uri<InlineCapacity> &lhs,
+                       const small_uri<InlineCapacity> &rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+/**
+ * \brief Less-than operator for the \c small_uri.
+ */
+template <std::size_t InlineCapacity>
+inline bool operator<(const small_uri<InlineCapacity> &lhs,
+                      const small_uri<InlineCapacity> &rhs) noexcept {
+  return lhs.view() < rhs.view();
+}
+
+/**
+ * \brief Greater-than operator for the \c small_uri.
+ */
+template <std::size_t InlineCapacity>
+inline bool operator>(const small_uri<InlineCapacity> &lhs,
+                      const small_uri<InlineCapacity> &rhs) noexcept {
+  return rhs < lhs;
+}
+
+/**
+ * \brief Less-than-or-equal-to operator for the \c small_uri.
+ */
+template <std::size_t InlineCapacity>
+inline bool operator<=(const small_uri<InlineCapacity> &lhs,
+                       const small_uri<InlineCapacity> &rhs) noexcept {
+  return !(rhs < lhs);
+}
+
+/**
+ * \brief Greater-than-or-equal-to operator for the \c small_uri.
+ */
+template <std::size_t InlineCapacity>
+inline bool operator>=(const small_uri<InlineCapacity> &lhs,
+                       const small_uri<InlineCapacity> &rhs) noexcept {
+  return !(lhs < rhs);
+}
+}  // namespace network
+
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+namespace std {
+template <std::size_t InlineCapacity>
+struct hash<network::small_uri<InlineCapacity>> {
+  std::size_t operator()(
+      const network::small_uri<InlineCapacity> &uri_) const noexcept {
+    return uri_.hash();
+  }
+};
+}  // namespace std
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+#ifdef NETWORK_URI_MSVC
+#pragma warning(pop)
+#endif
+
+#endif  // NETWORK_URI_SMALL_URI_INC
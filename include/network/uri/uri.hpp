@@ -23,6 +23,7 @@
 #include <network/uri/config.hpp>
 #include <network/uri/uri_errors.hpp>
 #include <network/uri/detail/uri_parts.hpp>
+#include <network/uri/detail/uri_hash.hpp>
 #include <network/uri/detail/encode.hpp>
 #include <network/uri/detail/decode.hpp>
 #include <network/uri/detail/translate.hpp>
@@ -36,6 +37,15 @@ namespace network {
 /**
  * \enum uri_comparison_level
  * \brief Defines the steps on the URI comparison ladder.
+ *
+ * At the syntax_based level, the scheme and the host are lower case,
+ * an IPv6 or IPv4 address is written in its canonical form (RFC 5952
+ * for IPv6, and without leading zeros for IPv4), percent encoded
+ * octets are upper case, percent encoded unreserved characters are
+ * decoded and dot segments are removed from the path. The
+ * scheme_based level does all of that and leaves out a port that is
+ * empty or is the default port of the scheme (see
+ * register_uri_scheme).
  */
 enum class uri_comparison_level {
   string_comparison,
@@ -43,6 +53,24 @@ enum class uri_comparison_level {
   scheme_based,
 };
 
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+namespace detail {
+// Hashes a URI as if it had been normalized at the given level.
+std::size_t hash_normalized(string_view uri, const compact_uri_parts &parts,
+                            uri_comparison_level level) noexcept;
+
+// Checks if normalizing a URI at the given level would leave it as it
+// is.
+bool is_normalized(string_view uri, const compact_uri_parts &parts,
+                   uri_comparison_level level) noexcept;
+
+// Compares two URIs as if they had been normalized at the given level.
+int compare_normalized(string_view lhs, const compact_uri_parts &lhs_parts,
+                       string_view rhs, const compact_uri_parts &rhs_parts,
+                       uri_comparison_level level) noexcept;
+}  // namespace detail
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
 /**
  * \ingroup uri
  * \class uri_builder network/uri/uri_builder.hpp network/uri.hpp
@@ -51,6 +79,34 @@ enum class uri_comparison_level {
  */
 class uri_builder;
 
+/**
+ * \ingroup uri
+ * \class uri_view network/uri/uri_view.hpp network/uri.hpp
+ * \brief A class that parses a URI in a string that it doesn't own.
+ * \sa uri
+ */
+class uri_view;
+
+/**
+ * \ingroup uri
+ * \class basic_uri network/uri/basic_uri.hpp network/uri.hpp
+ * \brief A class that parses a URI into a string that uses an
+ *        allocator.
+ * \sa uri
+ */
+template <class Allocator>
+class basic_uri;
+
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+class uri_pool;
+class cached_uri;
+
+namespace detail {
+template <class Derived>
+class uri_accessors;
+}  // namespace detail
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
 /**
  * \ingroup uri
  * \class uri network/uri/uri.hpp network/uri.hpp
@@ -84,6 +140,11 @@ class uri_builder;
 class uri {
 #if !defined(DOXYGEN_SHOULD_SKIP_THIS)
   friend class uri_builder;
+  friend class uri_view;
+  friend class uri_pool;
+  friend class cached_uri;
+  template <class Derived>
+  friend class detail::uri_accessors;
 #endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
 
  public:
@@ -201,10 +262,30 @@ class uri {
   }
 #endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
 
+  /**
+   * \brief Constructor.
+   * \param source A string that is to be parsed as a URI. The URI
+   *        takes ownership of its buffer instead of copying it.
+   * \throws uri_syntax_error if the source is not a valid URI.
+   */
+  explicit uri(string_type &&source);
+
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+  explicit uri(string_type &&source, std::error_code &ec);
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
 #if !defined(DOXYGEN_SHOULD_SKIP_THIS)
   explicit uri(const uri_builder &builder);
 #endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
 
+  /**
+   * \brief Constructor.
+   * \param view A URI that has already been parsed. The string is
+   *        copied but it isn't parsed again.
+   * \throws std::bad_alloc If the underlying string cannot be allocated.
+   */
+  explicit uri(const uri_view &view);
+
   /**
    * \brief Copy constructor.
    * \throws std::bad_alloc If the underlying string cannot be allocated.
@@ -421,6 +502,25 @@ class uri {
    */
   string_view view() const noexcept;
 
+  /**
+   * \brief Returns a hash of the URI string. The hash isn't stored, so
+   *        that a uri stays small: cached_uri and shared_uri keep it,
+   *        for URIs that are hashed many times.
+   * \returns The hash, which is the same as std::hash<uri>.
+   */
+  std::size_t hash() const noexcept;
+
+  /**
+   * \brief Returns a hash of the URI as if it had been normalized at a
+   *        given level in the comparison ladder, without normalizing
+   *        it.
+   * \param level The comparison level.
+   * \returns The hash, which is the same as the hash of
+   *          normalize(level), so URIs that compare equal at this
+   *          level have the same hash.
+   */
+  std::size_t hash(uri_comparison_level level) const noexcept;
+
   /**
    * \brief Checks if the uri object is empty, i.e. it has no parts.
    * \returns \c true if there are no parts, \c false otherwise.
@@ -446,9 +546,39 @@ class uri {
    * \param level The comparison level.
    * \returns A normalized uri.
    * \post compare(normalize(uri, level), level) == 0
+   * \throws uri_builder_error if the path has a ".." segment with
+   *         nothing to remove.
+   * \throws std::bad_alloc
+   */
+  uri normalize(uri_comparison_level level) const &;
+
+  /**
+   * \brief Normalizes a uri object that is no longer needed at a given
+   *        level in the comparison ladder, reusing its string.
+   * \param level The comparison level.
+   * \returns A normalized uri.
+   * \throws uri_builder_error if the path has a ".." segment with
+   *         nothing to remove.
    * \throws std::bad_alloc
+   * \sa normalize_in_place
    */
-  uri normalize(uri_comparison_level level) const;
+  uri normalize(uri_comparison_level level) &&;
+
+  /**
+   * \brief Normalizes this uri object at a given level in the
+   *        comparison ladder.
+   *
+   * Normalization rarely makes a URI longer, only when a slash is
+   * added to an empty or relative path or an IPv6 address grows in its
+   * canonical form, so the string is usually rewritten in its own
+   * buffer and doesn't allocate.
+   *
+   * \param level The comparison level.
+   * \throws uri_builder_error if the path has a ".." segment with
+   *         nothing to remove, in which case the uri is unchanged.
+   * \throws std::bad_alloc
+   */
+  void normalize_in_place(uri_comparison_level level);
 
   /**
    * \brief Returns a relative reference against the base URI.
@@ -474,6 +604,11 @@ class uri {
    * \returns \c 0 if the URIs are considered equal, \c -1 if this is
    *         less than other and and 1 if this is greater than
    *         other.
+   *
+   * The URIs are normalized as they are compared, so nothing is
+   * allocated, and the comparison stops at the first difference. A
+   * ".." segment that has no segment to remove is ignored, where
+   * normalize would throw.
    */
   int compare(const uri &other, uri_comparison_level level) const noexcept;
 
@@ -637,7 +772,7 @@ class uri {
   }
 
  private:
-  bool initialize(const string_type &uri);
+  bool initialize(string_type &&uri);
 
   void initialize(optional<string_type> scheme, optional<string_type> user_info,
                   optional<string_type> host, optional<string_type> port,
@@ -645,8 +780,7 @@ class uri {
                   optional<string_type> fragment);
 
   string_type uri_;
-  string_view uri_view_;
-  detail::uri_parts uri_parts_;
+  detail::compact_uri_parts uri_parts_;
 };
 
 /**
@@ -724,6 +858,70 @@ inline bool operator<=(const uri &lhs, const uri &rhs) noexcept {
 inline bool operator>=(const uri &lhs, const uri &rhs) noexcept {
   return !(lhs < rhs);
 }
+
+/**
+ * \brief A hash function object for URIs, that is equal for URIs that
+ *        compare equal at a given level in the comparison ladder.
+ *
+ * Example:
+ *
+ * \code
+ * std::unordered_set<network::uri, network::normalized_uri_hash,
+ *                    network::normalized_uri_equal> uris;
+ * uris.emplace("HTTP://cpp-netlib.org/a/../b");
+ * assert(uris.count(network::uri("http://cpp-netlib.org/b")) == 1);
+ * \endcode
+ */
+class normalized_uri_hash {
+ public:
+  /**
+   * \brief Constructor.
+   * \param level The comparison level.
+   */
+  explicit normalized_uri_hash(
+      uri_comparison_level level = uri_comparison_level::syntax_based) noexcept
+      : level_(level) {}
+
+  /**
+   * \brief Returns the hash of a URI.
+   * \param u A uri, or any other URI class with a hash(level) member.
+   * \returns The hash.
+   */
+  template <class Uri>
+  std::size_t operator()(const Uri &u) const noexcept {
+    return u.hash(level_);
+  }
+
+ private:
+  uri_comparison_level level_;
+};
+
+/**
+ * \brief An equality function object for URIs, that compares them at
+ *        a given level in the comparison ladder.
+ */
+class normalized_uri_equal {
+ public:
+  /**
+   * \brief Constructor.
+   * \param level The comparison level.
+   */
+  explicit normalized_uri_equal(
+      uri_comparison_level level = uri_comparison_level::syntax_based) noexcept
+      : level_(level) {}
+
+  /**
+   * \brief Compares two URIs.
+   * \returns \c true if the URIs compare equal.
+   */
+  template <class Uri>
+  bool operator()(const Uri &lhs, const Uri &rhs) const {
+    return lhs.compare(rhs, level_) == 0;
+  }
+
+ private:
+  uri_comparison_level level_;
+};
 }  // namespace network
 
 #if !defined(DOXYGEN_SHOULD_SKIP_THIS)
@@ -735,14 +933,8 @@ struct is_error_code_enum<network::uri_error> : public true_type {};
 namespace std {
 template <>
 struct hash<network::uri> {
-  std::size_t operator()(const network::uri &uri_) const {
-    std::size_t seed = 0;
-    std::for_each(std::begin(uri_), std::end(uri_),
-                  [&seed](network::uri::value_type v) {
-                    std::hash<network::uri::value_type> hasher;
-                    seed ^= hasher(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-                  });
-    return seed;
+  std::size_t operator()(const network::uri &uri_) const noexcept {
+    return uri_.hash();
   }
 };
 }  // namespace std
@@ -0,0 +1,214 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NETWORK_URI_URI_BATCH_INC
+#define NETWORK_URI_URI_BATCH_INC
+
+/**
+ * \file
+ * \brief Contains the uri_batch class and the parse_batch function.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <vector>
+#include <network/string_view.hpp>
+#include <network/uri/config.hpp>
+#include <network/uri/uri_errors.hpp>
+#include <network/uri/detail/uri_parts.hpp>
+
+#ifdef NETWORK_URI_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4251 4231 4660)
+#endif
+
+namespace network {
+class uri_batch;
+
+/**
+ * \brief Parses every line in a buffer of newline separated URIs.
+ * \param buffer The buffer. It must outlive the result.
+ * \param threads The number of threads to use. If this is \c 0, the
+ *        number of hardware threads is used.
+ * \returns The parts of every URI in the buffer.
+ * \throws std::bad_alloc
+ */
+uri_batch parse_batch(string_view buffer, unsigned threads = 1);
+
+/**
+ * \ingroup uri
+ * \class uri_batch network/uri/uri_batch.hpp network/uri.hpp
+ * \brief The result of parsing a buffer of newline separated URIs.
+ *
+ * The results are kept as a structure of arrays, with one entry per
+ * line in each array. None of the lines is copied: each component is
+ * stored as a pair of offsets from the start of its line, which is
+ * itself an offset into the buffer. A component that isn't present
+ * has the offsets \c npos.
+ *
+ * Leading and trailing whitespace (including a '\\r' before the
+ * newline) is not part of a line. A blank line is not a valid URI.
+ *
+ * Example:
+ *
+ * \code
+ * auto batch = network::parse_batch(buffer);
+ * for (std::size_t i = 0; i < batch.size(); ++i) {
+ *   if (batch.is_valid(i)) {
+ *     auto host = batch.component(i, network::uri_batch::component_type::host);
+ *   }
+ * }
+ * \endcode
+ */
+class uri_batch {
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+  friend uri_batch parse_batch(string_view buffer, unsigned threads);
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+ public:
+  /**
+   * \brief A reference to part of the buffer.
+   */
+  typedef network::string_view string_view;
+
+  /**
+   * \brief The type of an offset from the start of a line.
+   */
+  typedef std::uint32_t offset_type;
+
+  /**
+   * \brief The component of a URI.
+   */
+  typedef detail::uri_component component_type;
+
+  /**
+   * \brief The offset of a component that isn't present.
+   */
+  static const offset_type npos = std::numeric_limits<offset_type>::max();
+
+  /**
+   * \brief Default constructor.
+   */
+  uri_batch() noexcept;
+
+  /**
+   * \brief Returns the number of lines in the buffer.
+   * \returns The number of lines.
+   */
+  std::size_t size() const noexcept;
+
+  /**
+   * \brief Checks if there are no lines in the buffer.
+   * \returns \c true if there are no lines, \c false otherwise.
+   */
+  bool empty() const noexcept;
+
+  /**
+   * \brief Returns the buffer that was parsed.
+   * \returns The buffer.
+   */
+  string_view buffer() const noexcept;
+
+  /**
+   * \brief Returns a line, without leading and trailing whitespace.
+   * \param index The index of the line.
+   * \returns The line.
+   */
+  string_view line(std::size_t index) const noexcept;
+
+  /**
+   * \brief Tests whether a line is a valid URI.
+   * \param index The index of the line.
+   * \returns \c true if the line is a valid URI, \c false otherwise.
+   */
+  bool is_valid(std::size_t index) const noexcept;
+
+  /**
+   * \brief Returns the reason that a line isn't a valid URI.
+   * \param index The index of the line.
+   * \returns The error, or an empty error code if the line is valid.
+   */
+  std::error_code error(std::size_t index) const;
+
+  /**
+   * \brief Tests whether a URI has a component.
+   * \param index The index of the line.
+   * \param component The component.
+   * \returns \c true if the URI has the component, \c false otherwise.
+   * \pre is_valid(index)
+   */
+  bool has(std::size_t index, component_type component) const noexcept;
+
+  /**
+   * \brief Returns a component of a URI.
+   * \param index The index of the line.
+   * \param component The component.
+   * \returns The component, or an empty string_view if it isn't
+   *          present.
+   * \pre is_valid(index)
+   */
+  string_view component(std::size_t index, component_type component) const
+      noexcept;
+
+  /**
+   * \brief Returns the offset of each line in the buffer.
+   */
+  const std::vector<std::size_t> &line_offsets() const noexcept;
+
+  /**
+   * \brief Returns the length of each line.
+   */
+  const std::vector<offset_type> &line_lengths() const noexcept;
+
+  /**
+   * \brief Returns the offset of the start of a component in each
+   *        line, or \c npos.
+   */
+  const std::vector<offset_type> &first(component_type component) const
+      noexcept;
+
+  /**
+   * \brief Returns the offset of the end of a component in each line,
+   *        or \c npos.
+   */
+  const std::vector<offset_type> &last(component_type component) const
+      noexcept;
+
+  /**
+   * \brief Returns a bit map of the valid lines, 64 lines per word,
+   *        starting from the least significant bit.
+   */
+  const std::vector<std::uint64_t> &valid_bits() const noexcept;
+
+  /**
+   * \brief Returns the error for each line, which is zero for a line
+   *        that is valid.
+   */
+  const std::vector<uri_error> &errors() const noexcept;
+
+ private:
+  static std::size_t index(component_type component) noexcept {
+    return static_cast<std::size_t>(component);
+  }
+
+  void parse_lines(std::size_t first, std::size_t last) noexcept;
+
+  string_view buffer_;
+  std::vector<std::size_t> line_offsets_;
+  std::vector<offset_type> line_lengths_;
+  std::vector<offset_type> first_[detail::compact_uri_parts::component_count];
+  std::vector<offset_type> last_[detail::compact_uri_parts::component_count];
+  std::vector<std::uint64_t> valid_bits_;
+  std::vector<uri_error> errors_;
+};
+}  // namespace network
+
+#ifdef NETWORK_URI_MSVC
+#pragma warning(pop)
+#endif
+
+#endif  // NETWORK_URI_URI_BATCH_INC
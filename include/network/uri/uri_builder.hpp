@@ -67,6 +67,8 @@ struct path_converter {
 class uri_builder {
 #if !defined(DOXYGEN_SHOULD_SKIP_THIS)
   friend class uri;
+  template <class Allocator>
+  friend class basic_uri;
 #endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
 
   uri_builder(const uri_builder &) = delete;
@@ -254,6 +256,18 @@ class uri_builder {
    */
   network::uri uri() const;
 
+  /**
+   * \brief Builds a new basic_uri object, whose string is allocated
+   *        with the given allocator.
+   * \param alloc The allocator.
+   * \returns A valid basic_uri object.
+   * \throws uri_builder_error if the uri_builder is unable to build
+   *         a valid URI.
+   * \note This is defined in network/uri/basic_uri.hpp.
+   */
+  template <class Allocator>
+  network::basic_uri<Allocator> uri(const Allocator &alloc) const;
+
  private:
   void set_scheme(string_type &&scheme);
   void set_user_info(string_type &&user_info);
@@ -31,7 +31,8 @@ enum class uri_error {
   // parser errors
   invalid_syntax = 1,
 
-  // builder errors
+  // builder errors, which parse_uri also uses to say which part of
+  // the URI is invalid
   invalid_uri,
   invalid_scheme,
   invalid_user_info,
@@ -45,6 +46,11 @@ enum class uri_error {
   not_enough_input,
   non_hex_input,
   conversion_failed,
+
+  // detailed parser errors
+  empty_uri,
+  invalid_pct_encoded,
+  uri_too_long,
 };
 
 const std::error_category &uri_category();
@@ -0,0 +1,435 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NETWORK_URI_URI_INCREMENTAL_PARSER_INC
+#define NETWORK_URI_URI_INCREMENTAL_PARSER_INC
+
+/**
+ * \file
+ * \brief Contains the uri_incremental_parser class.
+ */
+
+#include <cstddef>
+#include <network/string_view.hpp>
+#include <network/uri/config.hpp>
+#include <network/uri/detail/grammar.hpp>
+#include <network/uri/detail/uri_parts.hpp>
+
+namespace network {
+/**
+ * \ingroup uri
+ * \class uri_incremental_parser network/uri/uri_incremental_parser.hpp
+ * \brief A parser that accepts a URI in chunks, as it arrives.
+ *
+ * The parser keeps its state between calls to \c feed, so the chunks
+ * never need to be copied into one buffer. Each component is passed
+ * to a handler as soon as the delimiter that ends it has been seen,
+ * as a pair of offsets from the start of the URI. The components
+ * that end with the URI are passed to the handler by \c finish.
+ *
+ * The parser accepts exactly the same URIs as the uri class, and
+ * reports the same components. With C++ 14 or later, it can be used in
+ * a constant expression if the handler can.
+ *
+ * Example:
+ *
+ * \code
+ * network::uri_incremental_parser parser;
+ * auto handler = [](network::uri_incremental_parser::component c,
+ *                   std::size_t first, std::size_t last) { ... };
+ * parser.feed("http://www.exam", handler);
+ * parser.feed("ple.com/path", handler);
+ * assert(parser.finish(handler));
+ * \endcode
+ */
+class uri_incremental_parser {
+ public:
+  /**
+   * \brief The component that is passed to the handler.
+   */
+  typedef detail::uri_component component;
+
+  /**
+   * \brief Constructor.
+   */
+  constexpr uri_incremental_parser() noexcept
+      : state_(uri_state::scheme),
+        hp_state_(hier_part_state::first_slash),
+        offset_(0),
+        first_(0),
+        last_colon_(0),
+        has_colon_(false),
+        after_bracket_(false),
+        pct_(0),
+        user_info_valid_(true),
+        user_info_pct_(0),
+        port_(),
+        failed_(false) {}
+
+  /**
+   * \brief Parses the next chunk of the URI.
+   * \param chunk The next chunk.
+   * \param handler A function that is called with a component and the
+   *        offsets of its first and end + 1th elements.
+   * \returns \c false if the URI is already known to be invalid,
+   *          \c true otherwise.
+   */
+  template <class Handler>
+  NETWORK_URI_CXX14_CONSTEXPR bool feed(string_view chunk, Handler &&handler) {
+    if (failed_ || (state_ == uri_state::done)) {
+      failed_ = true;
+      return false;
+    }
+
+    for (auto c : chunk) {
+      if (!consume(c, handler)) {
+        failed_ = true;
+        return false;
+      }
+      ++offset_;
+    }
+    return true;
+  }
+
+  /**
+   * \brief Tells the parser that the URI is complete, and passes the
+   *        remaining components to the handler.
+   * \param handler A function that is called with a component and the
+   *        offsets of its first and end + 1th elements.
+   * \returns \c true if the URI is valid, \c false otherwise.
+   * \post The parser must be reset before it is used again.
+   */
+  template <class Handler>
+  NETWORK_URI_CXX14_CONSTEXPR bool finish(Handler &&handler) {
+    if (failed_ || (state_ == uri_state::done) || (offset_ == 0)) {
+      failed_ = true;
+      return false;
+    }
+
+    bool is_valid = false;
+    if (state_ == uri_state::hier_part) {
+      is_valid = finish_hier_part(handler);
+    } else if ((state_ == uri_state::query) && (pct_ == 0)) {
+      handler(component::query, first_, offset_);
+      is_valid = true;
+    } else if ((state_ == uri_state::fragment) && (pct_ == 0)) {
+      handler(component::fragment, first_, offset_);
+      is_valid = true;
+    }
+
+    state_ = uri_state::done;
+    failed_ = !is_valid;
+    return is_valid;
+  }
+
+  /**
+   * \brief Resets the parser so that it can be used for another URI.
+   */
+  NETWORK_URI_CXX14_CONSTEXPR void reset() noexcept {
+    state_ = uri_state::scheme;
+    hp_state_ = hier_part_state::first_slash;
+    offset_ = 0;
+    first_ = 0;
+    last_colon_ = 0;
+    has_colon_ = false;
+    after_bracket_ = false;
+    pct_ = 0;
+    user_info_valid_ = true;
+    user_info_pct_ = 0;
+    port_.reset();
+    failed_ = false;
+  }
+
+  /**
+   * \brief Tests whether the URI is already known to be invalid.
+   * \returns \c true if the parser has failed, \c false otherwise.
+   */
+  constexpr bool failed() const noexcept { return failed_; }
+
+  /**
+   * \brief Returns the number of characters that have been parsed.
+   * \returns The number of characters.
+   */
+  constexpr std::size_t size() const noexcept { return offset_; }
+
+ private:
+  enum class uri_state { scheme, hier_part, query, fragment, done };
+
+  enum class hier_part_state {
+    first_slash,
+    second_slash,
+    authority,
+    host,
+    host_ipv6,
+    port,
+    path
+  };
+
+  template <class Handler>
+  NETWORK_URI_CXX14_CONSTEXPR bool consume(char c, Handler &handler) {
+    const auto pos = offset_;
+    if (state_ == uri_state::scheme) {
+      // The first character must be a letter
+      if (pos == 0) {
+        return detail::is_char_class(c, detail::alpha_char);
+      }
+
+      if (c == ':') {
+        handler(component::scheme, std::size_t(0), pos);
+        state_ = uri_state::hier_part;
+        return true;
+      }
+      return detail::is_char_class(c, detail::scheme_char);
+    } else if (state_ == uri_state::hier_part) {
+      return consume_hier_part(c, handler);
+    } else if (state_ == uri_state::query) {
+      if (pct_ != 0) {
+        return consume_pct_encoded(c);
+      }
+
+      if (c == '#') {
+        handler(component::query, first_, pos);
+        start(uri_state::fragment, pos + 1);
+        return true;
+      }
+      return consume_char(c, detail::query_char);
+    } else if (state_ == uri_state::fragment) {
+      if (pct_ != 0) {
+        return consume_pct_encoded(c);
+      }
+      return consume_char(c, detail::query_char);
+    }
+    return false;
+  }
+
+  template <class Handler>
+  NETWORK_URI_CXX14_CONSTEXPR bool consume_hier_part(char c, Handler &handler) {
+    const auto pos = offset_;
+    if (hp_state_ == hier_part_state::first_slash) {
+      // if this isn't a slash, it is the first character in the path
+      // and it isn't checked
+      hp_state_ = (c == '/') ? hier_part_state::second_slash
+                             : hier_part_state::path;
+      first_ = pos;
+    } else if (hp_state_ == hier_part_state::second_slash) {
+      if (c == '/') {
+        hp_state_ = hier_part_state::authority;
+        first_ = pos + 1;
+        has_colon_ = false;
+        user_info_valid_ = true;
+        user_info_pct_ = 0;
+      } else {
+        // the path started with the first slash, and this character
+        // isn't checked
+        hp_state_ = hier_part_state::path;
+      }
+    } else if (hp_state_ == hier_part_state::authority) {
+      if ((pos == first_) && ((c == '@') || (c == ':'))) {
+        return false;
+      }
+
+      if (c == '@') {
+        if (!user_info_valid_ || (user_info_pct_ != 0)) {
+          return false;
+        }
+        handler(component::user_info, first_, pos);
+        hp_state_ = hier_part_state::host;
+        first_ = pos + 1;
+        return true;
+      } else if (c == '[') {
+        // this is an IPv6 address
+        hp_state_ = hier_part_state::host_ipv6;
+        after_bracket_ = false;
+        first_ = pos;
+        return true;
+      } else if ((c == '/') || (c == '?') || (c == '#')) {
+        // we skipped right past the host and port
+        return set_host_and_port(pos, handler) && end_host(c, handler);
+      } else if (c == ':') {
+        has_colon_ = true;
+        last_colon_ = pos;
+        port_.reset();
+      } else {
+        port_.consume(c);
+      }
+      consume_user_info(c);
+    } else if (hp_state_ == hier_part_state::host) {
+      if (pos == first_) {
+        if (c == '[') {
+          // this is an IPv6 address
+          hp_state_ = hier_part_state::host_ipv6;
+          after_bracket_ = false;
+          return true;
+        } else if (c == ':') {
+          return false;
+        }
+      }
+
+      if ((c == ':') || (c == '/') || (c == '?') || (c == '#')) {
+        handler(component::host, first_, pos);
+        return end_host(c, handler);
+      }
+    } else if (hp_state_ == hier_part_state::host_ipv6) {
+      if (after_bracket_ &&
+          ((c == ':') || (c == '/') || (c == '?') || (c == '#'))) {
+        handler(component::host, first_, pos);
+        return end_host(c, handler);
+      }
+      after_bracket_ = (c == ']');
+    } else if (hp_state_ == hier_part_state::port) {
+      if (c == '/') {
+        if (!port_.is_valid()) {
+          return false;
+        }
+        handler(component::port, first_, pos);
+        hp_state_ = hier_part_state::path;
+        first_ = pos;
+      } else if (!detail::is_char_class(c, detail::digit_char)) {
+        return false;
+      } else {
+        port_.consume(c);
+      }
+    } else if (hp_state_ == hier_part_state::path) {
+      if (pct_ != 0) {
+        return consume_pct_encoded(c);
+      }
+
+      if (c == '?') {
+        handler(component::path, first_, pos);
+        start(uri_state::query, pos + 1);
+      } else if (c == '#') {
+        handler(component::path, first_, pos);
+        start(uri_state::fragment, pos + 1);
+      } else {
+        return consume_char(c, detail::path_char);
+      }
+    }
+    return true;
+  }
+
+  template <class Handler>
+  NETWORK_URI_CXX14_CONSTEXPR bool finish_hier_part(Handler &handler) {
+    const auto last = offset_;
+    if ((hp_state_ == hier_part_state::first_slash) ||
+        (hp_state_ == hier_part_state::second_slash)) {
+      return true;
+    } else if (hp_state_ == hier_part_state::authority) {
+      if ((first_ == last) || !set_host_and_port(last, handler)) {
+        return false;
+      }
+    } else if (hp_state_ == hier_part_state::host) {
+      if (first_ == last) {
+        return false;
+      }
+      handler(component::host, first_, last);
+    } else if (hp_state_ == hier_part_state::host_ipv6) {
+      handler(component::host, first_, last);
+    } else if (hp_state_ == hier_part_state::port) {
+      if (!port_.is_valid()) {
+        return false;
+      }
+      handler(component::port, first_, last);
+    } else if (hp_state_ == hier_part_state::path) {
+      if (pct_ != 0) {
+        return false;
+      }
+      handler(component::path, first_, last);
+      return true;
+    }
+
+    // the path is empty, but valid
+    handler(component::path, last, last);
+    return true;
+  }
+
+  template <class Handler>
+  NETWORK_URI_CXX14_CONSTEXPR bool set_host_and_port(std::size_t last, Handler &handler) {
+    if (!has_colon_) {
+      handler(component::host, first_, last);
+    } else {
+      handler(component::host, first_, last_colon_);
+      if (!port_.is_valid()) {
+        return false;
+      }
+      handler(component::port, last_colon_ + 1, last);
+    }
+    return true;
+  }
+
+  // Moves on from the host to the port, path, query or fragment,
+  // depending on the delimiter.
+  template <class Handler>
+  NETWORK_URI_CXX14_CONSTEXPR bool end_host(char delimiter, Handler &handler) {
+    const auto pos = offset_;
+    if (delimiter == ':') {
+      hp_state_ = hier_part_state::port;
+      first_ = pos + 1;
+      port_.reset();
+    } else if (delimiter == '/') {
+      hp_state_ = hier_part_state::path;
+      first_ = pos;
+    } else {
+      // the path is empty, but valid, and the next part is the query
+      // or fragment
+      handler(component::path, pos, pos);
+      start((delimiter == '?') ? uri_state::query : uri_state::fragment,
+            pos + 1);
+    }
+    return true;
+  }
+
+  NETWORK_URI_CXX14_CONSTEXPR void start(uri_state state,
+                                         std::size_t first) noexcept {
+    state_ = state;
+    first_ = first;
+    pct_ = 0;
+  }
+
+  // Matches a single character from the given class, or starts a
+  // pct-encoded triplet.
+  NETWORK_URI_CXX14_CONSTEXPR bool consume_char(
+      char c, unsigned short classes) noexcept {
+    if (c == '%') {
+      pct_ = 2;
+      return true;
+    }
+    return detail::is_char_class(c, classes);
+  }
+
+  NETWORK_URI_CXX14_CONSTEXPR bool consume_pct_encoded(char c) noexcept {
+    --pct_;
+    return detail::is_char_class(c, detail::hexdig_char);
+  }
+
+  // The authority is only known to contain user info once the '@' is
+  // seen, so it is checked as it goes.
+  NETWORK_URI_CXX14_CONSTEXPR void consume_user_info(char c) noexcept {
+    if (user_info_pct_ != 0) {
+      --user_info_pct_;
+      user_info_valid_ = user_info_valid_ &&
+                         detail::is_char_class(c, detail::hexdig_char);
+    } else if (c == '%') {
+      user_info_pct_ = 2;
+    } else if (!detail::is_char_class(c, detail::user_info_char)) {
+      user_info_valid_ = false;
+    }
+  }
+
+  uri_state state_;
+  hier_part_state hp_state_;
+  std::size_t offset_;
+  std::size_t first_;
+  std::size_t last_colon_;
+  bool has_colon_;
+  bool after_bracket_;
+  unsigned char pct_;
+  bool user_info_valid_;
+  unsigned char user_info_pct_;
+  detail::port_number port_;
+  bool failed_;
+};
+}  // namespace network
+
+#endif  // NETWORK_URI_URI_INCREMENTAL_PARSER_INC
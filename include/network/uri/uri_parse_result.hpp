@@ -0,0 +1,100 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NETWORK_URI_URI_PARSE_RESULT_INC
+#define NETWORK_URI_URI_PARSE_RESULT_INC
+
+/**
+ * \file
+ * \brief Contains the parse_result class and the parse_uri function.
+ */
+
+#include <cstddef>
+#include <network/string_view.hpp>
+#include <network/uri/config.hpp>
+#include <network/uri/uri_errors.hpp>
+#include <network/uri/uri_view.hpp>
+
+#ifdef NETWORK_URI_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4251 4231 4660)
+#endif
+
+namespace network {
+/**
+ * \brief Parses a URI without throwing an exception.
+ * \param source A string that is to be parsed as a URI. Leading and
+ *        trailing whitespace is ignored. It must outlive the result.
+ * \returns The URI, or the reason it is invalid and where.
+ */
+parse_result parse_uri(string_view source) noexcept;
+
+/**
+ * \ingroup uri
+ * \class parse_result network/uri/uri_parse_result.hpp network/uri.hpp
+ * \brief The result of parse_uri.
+ *
+ * If the source isn't a valid URI, the result says which part of it is
+ * invalid and the offset in the source at which parsing stopped. An
+ * empty source is not a valid URI.
+ *
+ * Example:
+ *
+ * \code
+ * auto result = network::parse_uri("http://www.example.com:99999/");
+ * if (!result) {
+ *   assert(network::uri_error::invalid_port == result.error());
+ *   assert(23 == result.position());
+ * }
+ * \endcode
+ */
+class parse_result {
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+  friend parse_result parse_uri(string_view source) noexcept;
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+ public:
+  /**
+   * \brief Default constructor. The result is an empty_uri error.
+   */
+  parse_result() noexcept;
+
+  /**
+   * \brief Tests whether the source is a valid URI.
+   * \returns \c true if the source is valid, \c false otherwise.
+   */
+  explicit operator bool() const noexcept;
+
+  /**
+   * \brief Returns the reason that the source isn't a valid URI.
+   * \returns The error, or \c uri_error() if the source is valid.
+   */
+  uri_error error() const noexcept;
+
+  /**
+   * \brief Returns the offset in the source at which parsing stopped.
+   * \returns The offset of the first invalid character, or the end of
+   *          the URI if it is valid.
+   */
+  std::size_t position() const noexcept;
+
+  /**
+   * \brief Returns the URI.
+   * \returns The URI, which is empty if the source isn't valid.
+   */
+  const uri_view &view() const noexcept;
+
+ private:
+  uri_view view_;
+  uri_error error_;
+  std::size_t position_;
+};
+}  // namespace network
+
+#ifdef NETWORK_URI_MSVC
+#pragma warning(pop)
+#endif
+
+#endif  // NETWORK_URI_URI_PARSE_RESULT_INC
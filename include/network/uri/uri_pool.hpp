@@ -0,0 +1,286 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NETWORK_URI_URI_POOL_INC
+#define NETWORK_URI_URI_POOL_INC
+
+/**
+ * \file
+ * \brief Contains the uri_pool class.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <system_error>
+#include <vector>
+#include <network/string_view.hpp>
+#include <network/uri/config.hpp>
+#include <network/uri/uri.hpp>
+#include <network/uri/uri_view.hpp>
+#include <network/uri/uri_batch.hpp>
+#include <network/uri/detail/uri_parts.hpp>
+
+#ifdef NETWORK_URI_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4251 4231 4660)
+#endif
+
+namespace network {
+/**
+ * \ingroup uri
+ * \class uri_pool network/uri/uri_pool.hpp network/uri.hpp
+ * \brief A set of URIs, each of which is stored once and identified by
+ *        a 32-bit handle.
+ *
+ * Inserting a URI that is already in the pool returns the handle that
+ * it was given the first time, so two handles from the same pool are
+ * equal if and only if their URIs are equivalent at the pool's
+ * comparison level. At a level other than string_comparison, the pool
+ * keeps the normalized URI.
+ *
+ * The strings are copied into large slabs, one after another, and the
+ * component offsets are kept with them, so a handle is turned back
+ * into a uri_view without parsing it again. Nothing is removed from the
+ * pool until it is cleared or destroyed, and the uri_views remain
+ * valid until then.
+ *
+ * Example:
+ *
+ * \code
+ * network::uri_pool pool;
+ * auto first = pool.insert("http://cpp-netlib.org/");
+ * auto second = pool.insert("http://cpp-netlib.org/");
+ * assert(first == second);
+ * assert("cpp-netlib.org" == pool[first].host());
+ * \endcode
+ *
+ * Const member functions may be called from several threads at once,
+ * but insert may not be called while another thread uses the pool.
+ */
+class uri_pool {
+ public:
+  /**
+   * \brief The type of a handle to a URI in the pool.
+   */
+  typedef std::uint32_t handle_type;
+
+  /**
+   * \brief The handle of a URI that isn't in the pool.
+   */
+  static const handle_type npos = std::numeric_limits<handle_type>::max();
+
+  /**
+   * \brief The default size of a slab, in bytes.
+   */
+  static const std::size_t default_slab_size = 64 * 1024;
+
+  /**
+   * \brief Constructor.
+   * \param level The comparison level that is used to find URIs that
+   *        are already in the pool.
+   * \param slab_size The size of each slab. A URI that is longer is
+   *        given a slab of its own.
+   */
+  explicit uri_pool(
+      uri_comparison_level level = uri_comparison_level::string_comparison,
+      std::size_t slab_size = default_slab_size);
+
+  uri_pool(const uri_pool &) = delete;
+  uri_pool &operator=(const uri_pool &) = delete;
+
+  /**
+   * \brief Move constructor. The handles and uri_views of the other
+   *        pool remain valid in this one.
+   */
+  uri_pool(uri_pool &&other) noexcept;
+
+  /**
+   * \brief Move assignment operator.
+   */
+  uri_pool &operator=(uri_pool &&other) noexcept;
+
+  /**
+   * \brief Destructor.
+   */
+  ~uri_pool();
+
+  /**
+   * \brief Swaps one uri_pool object with another.
+   * \param other The other uri_pool object.
+   */
+  void swap(uri_pool &other) noexcept;
+
+  /**
+   * \brief Inserts a URI, unless an equivalent URI is already in the
+   *        pool.
+   * \param source A string that is to be parsed as a URI. Leading
+   *        and trailing whitespace is ignored.
+   * \returns The handle of the URI.
+   * \throws uri_syntax_error if the source is not a valid URI.
+   * \throws std::length_error if the pool is full.
+   * \throws std::bad_alloc
+   */
+  handle_type insert(string_view source);
+
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+  handle_type insert(string_view source, std::error_code &ec);
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+  /**
+   * \brief Inserts a URI that has already been parsed, unless an
+   *        equivalent URI is already in the pool.
+   * \param view The URI.
+   * \returns The handle of the URI.
+   * \throws std::length_error if the pool is full.
+   * \throws std::bad_alloc
+   */
+  handle_type insert(const uri_view &view);
+
+  /**
+   * \brief Inserts a URI that has already been parsed, unless an
+   *        equivalent URI is already in the pool.
+   * \param other The URI.
+   * \returns The handle of the URI.
+   * \throws std::length_error if the pool is full.
+   * \throws std::bad_alloc
+   */
+  handle_type insert(const uri &other);
+
+  /**
+   * \brief Inserts every valid line in a batch, without parsing it
+   *        again.
+   * \param batch The batch.
+   * \returns The handle of each line, or \c npos for a line that isn't
+   *          a valid URI.
+   * \throws std::length_error if the pool is full.
+   * \throws std::bad_alloc
+   */
+  std::vector<handle_type> insert(const uri_batch &batch);
+
+  /**
+   * \brief Inserts a range of strings.
+   * \param first The first string in the range.
+   * \param last The end of the range.
+   * \param handles An output iterator to which the handle of each
+   *        string is written.
+   * \returns The output iterator after the last handle.
+   * \throws uri_syntax_error if a string is not a valid URI.
+   * \throws std::length_error if the pool is full.
+   * \throws std::bad_alloc
+   */
+  template <class InputIterator, class OutputIterator>
+  OutputIterator insert(InputIterator first, InputIterator last,
+                        OutputIterator handles) {
+    for (; first != last; ++first) {
+      *handles++ = insert(string_view(*first));
+    }
+    return handles;
+  }
+
+  /**
+   * \brief Finds a URI without inserting it.
+   * \param source A string that is to be parsed as a URI.
+   * \returns The handle of an equivalent URI, or \c npos if there
+   *          isn't one or the source is not a valid URI.
+   * \throws std::bad_alloc
+   */
+  handle_type find(string_view source) const;
+
+  /**
+   * \brief Finds a URI without inserting it.
+   * \param view The URI.
+   * \returns The handle of an equivalent URI, or \c npos if there
+   *          isn't one.
+   * \throws std::bad_alloc
+   */
+  handle_type find(const uri_view &view) const;
+
+  /**
+   * \brief Returns a URI in the pool.
+   * \param handle The handle of the URI.
+   * \returns The URI, which is valid until the pool is cleared or
+   *          destroyed.
+   * \pre handle < size()
+   */
+  uri_view operator[](handle_type handle) const noexcept;
+
+  /**
+   * \brief Returns the number of URIs in the pool.
+   * \returns The number of URIs.
+   */
+  std::size_t size() const noexcept;
+
+  /**
+   * \brief Checks if there are no URIs in the pool.
+   * \returns \c true if the pool is empty, \c false otherwise.
+   */
+  bool empty() const noexcept;
+
+  /**
+   * \brief Returns the comparison level of the pool.
+   * \returns The comparison level.
+   */
+  uri_comparison_level level() const noexcept;
+
+  /**
+   * \brief Makes room for a number of URIs, so that inserting them
+   *        doesn't grow the index.
+   * \param count The number of URIs.
+   * \throws std::bad_alloc
+   */
+  void reserve(std::size_t count);
+
+  /**
+   * \brief Returns the number of bytes that the pool has allocated,
+   *        for the slabs, the component offsets and the index.
+   * \returns The number of bytes.
+   */
+  std::size_t allocated_bytes() const noexcept;
+
+  /**
+   * \brief Removes every URI from the pool, and frees its memory.
+   */
+  void clear() noexcept;
+
+ private:
+  struct entry {
+    const char *data;
+    std::uint32_t size;
+    detail::compact_uri_parts parts;
+  };
+
+  struct slot {
+    std::uint32_t hash;
+    handle_type handle;
+  };
+
+  handle_type intern(string_view text, const detail::compact_uri_parts &parts);
+  handle_type lookup(string_view text, std::uint32_t hash) const noexcept;
+  char *allocate(std::size_t size);
+  void rehash(std::size_t capacity);
+
+  uri_comparison_level level_;
+  std::size_t slab_size_;
+  std::vector<std::unique_ptr<char[]>> slabs_;
+  char *slab_next_;
+  std::size_t slab_left_;
+  std::size_t slab_bytes_;
+  std::vector<entry> entries_;
+  std::vector<slot> index_;
+};
+
+/**
+ * \brief Swaps one uri_pool object with another.
+ */
+inline void swap(uri_pool &lhs, uri_pool &rhs) noexcept { lhs.swap(rhs); }
+}  // namespace network
+
+#ifdef NETWORK_URI_MSVC
+#pragma warning(pop)
+#endif
+
+#endif  // NETWORK_URI_URI_POOL_INC
@@ -0,0 +1,58 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NETWORK_URI_SCHEMES_INC
+#define NETWORK_URI_SCHEMES_INC
+
+/**
+ * \file
+ * \brief Contains the registry of URI schemes that is used for
+ *        scheme_based normalization.
+ */
+
+#include <network/string_view.hpp>
+#include <network/optional.hpp>
+#include <network/uri/config.hpp>
+
+namespace network {
+/**
+ * \ingroup uri
+ * \brief Registers the default port of a scheme, which is left out of
+ *        a URI with that scheme when it is normalized at the
+ *        scheme_based level.
+ *
+ * The default ports of http, https, ws, wss and ftp are known without
+ * being registered, and a registration replaces them. Schemes are
+ * registered at startup: a URI that is normalized or compared while a
+ * scheme is being registered may or may not see it.
+ *
+ * Example:
+ *
+ * \code
+ * network::register_uri_scheme("gopher", "70");
+ * network::uri instance("gopher://example.com:70/");
+ * assert(instance.normalize(network::uri_comparison_level::scheme_based)
+ *            .view() == "gopher://example.com/");
+ * \endcode
+ *
+ * \param scheme The scheme, which is compared without regard to case.
+ * \param default_port The default port, which is a string of digits.
+ * \throws std::system_error with uri_error::invalid_scheme or
+ *         uri_error::invalid_port if either isn't valid.
+ * \throws std::bad_alloc
+ */
+void register_uri_scheme(string_view scheme, string_view default_port);
+
+/**
+ * \ingroup uri
+ * \brief Finds the default port of a scheme.
+ * \param scheme The scheme, which is compared without regard to case.
+ * \returns The default port, without leading zeros, or nullopt if the
+ *          scheme has no default port.
+ */
+optional<string_view> find_default_port(string_view scheme) noexcept;
+}  // namespace network
+
+#endif  // NETWORK_URI_SCHEMES_INC
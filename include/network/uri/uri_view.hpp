@@ -0,0 +1,431 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NETWORK_URI_URI_VIEW_INC
+#define NETWORK_URI_URI_VIEW_INC
+
+/**
+ * \file
+ * \brief Contains the uri_view class.
+ */
+
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <network/string_view.hpp>
+#include <network/uri/config.hpp>
+#include <network/uri/uri.hpp>
+#include <network/uri/uri_incremental_parser.hpp>
+#include <network/uri/detail/uri_parts.hpp>
+
+#ifdef NETWORK_URI_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4251 4231 4660)
+#endif
+
+namespace network {
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+class parse_result;
+class uri_view;
+class uri_pool;
+
+namespace detail {
+template <class Derived>
+class uri_accessors;
+}  // namespace detail
+
+inline namespace literals {
+inline namespace uri_literals {
+inline NETWORK_URI_CXX14_CONSTEXPR uri_view operator"" _uri(const char *source,
+                                                           std::size_t length);
+}  // namespace uri_literals
+}  // namespace literals
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+/**
+ * \ingroup uri
+ * \class uri_view network/uri/uri_view.hpp network/uri.hpp
+ * \brief A class that parses a URI in a string that it doesn't own
+ *        into its component parts.
+ *
+ * The uri_view has the same accessors as the uri, but it refers to
+ * the caller's buffer instead of copying it, so constructing one
+ * never allocates. The buffer must outlive the uri_view and every
+ * string_view that is returned from it. A uri can be constructed
+ * from a uri_view when the value needs to be kept.
+ *
+ * Example:
+ *
+ * \code
+ * std::string buffer("http://cpp-netlib.org/");
+ * network::uri_view instance(buffer);
+ * assert("cpp-netlib.org" == instance.host());
+ * network::uri copy(instance);
+ * \endcode
+ *
+ * \sa uri
+ */
+class uri_view {
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+  friend class uri;
+  friend class uri_pool;
+  template <class Derived>
+  friend class detail::uri_accessors;
+  friend parse_result parse_uri(string_view source) noexcept;
+  friend NETWORK_URI_CXX14_CONSTEXPR uri_view
+  literals::uri_literals::operator"" _uri(const char *source,
+                                          std::size_t length);
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+ public:
+  /**
+   * \brief A reference to the underlying string_type parts.
+   */
+  typedef network::string_view string_view;
+
+  /**
+   * \brief The char traits.
+   */
+  typedef string_view::traits_type traits_type;
+
+  /**
+   * \brief The URI const_iterator type.
+   */
+  typedef string_view::const_iterator const_iterator;
+
+  /**
+   * \brief The URI iterator type.
+   */
+  typedef const_iterator iterator;
+
+  /**
+   * \brief The URI value_type.
+   */
+  typedef std::iterator_traits<iterator>::value_type value_type;
+
+  /**
+   * \brief An iterator over the key-value pairs in the query.
+   */
+  typedef uri::query_iterator query_iterator;
+
+  /**
+   * \brief Default constructor.
+   */
+  constexpr uri_view() noexcept : uri_(), uri_parts_() {}
+
+  /**
+   * \brief Constructor.
+   * \param source A string that is to be parsed as a URI. Leading
+   *        and trailing whitespace is ignored.
+   * \throws uri_syntax_error if the source is not a valid URI.
+   */
+  explicit uri_view(string_view source);
+
+  /**
+   * \brief Constructor.
+   * \param source A string that is to be parsed as a URI. Leading
+   *        and trailing whitespace is ignored.
+   * \param ec Error code set if the source is not a valid URI.
+   */
+  uri_view(string_view source, std::error_code &ec) noexcept;
+
+  /**
+   * \brief Returns an iterator at the first element in the
+   *        underlying sequence.
+   * \return An iterator starting at the first element.
+   */
+  constexpr const_iterator begin() const noexcept { return uri_.begin(); }
+
+  /**
+   * \brief Returns an iterator at the end + 1th element in the
+   *        underlying sequence.
+   * \return An iterator starting at the end + 1th element.
+   */
+  constexpr const_iterator end() const noexcept { return uri_.end(); }
+
+  /**
+   * \brief Tests whether this URI has a scheme component.
+   * \return \c true if the URI has a scheme, \c false otherwise.
+   */
+  constexpr bool has_scheme() const noexcept {
+    return uri_parts_.has(detail::uri_component::scheme);
+  }
+
+  /**
+   * \brief Returns the URI scheme.
+   * \return The scheme.
+   * \pre has_scheme()
+   */
+  constexpr string_view scheme() const noexcept {
+    return uri_parts_.get(uri_.data(), detail::uri_component::scheme);
+  }
+
+  /**
+   * \brief Tests whether this URI has a user info component.
+   * \return \c true if the URI has a user info, \c false otherwise.
+   */
+  constexpr bool has_user_info() const noexcept {
+    return uri_parts_.has(detail::uri_component::user_info);
+  }
+
+  /**
+   * \brief Returns the URI user info.
+   * \return The user info.
+   * \pre has_user_info()
+   */
+  constexpr string_view user_info() const noexcept {
+    return uri_parts_.get(uri_.data(), detail::uri_component::user_info);
+  }
+
+  /**
+   * \brief Tests whether this URI has a host component.
+   * \return \c true if the URI has a host, \c false otherwise.
+   */
+  constexpr bool has_host() const noexcept {
+    return uri_parts_.has(detail::uri_component::host);
+  }
+
+  /**
+   * \brief Returns the URI host.
+   * \return The host.
+   * \pre has_host()
+   */
+  constexpr string_view host() const noexcept {
+    return uri_parts_.get(uri_.data(), detail::uri_component::host);
+  }
+
+  /**
+   * \brief Tests whether this URI has a port component.
+   * \return \c true if the URI has a port, \c false otherwise.
+   */
+  constexpr bool has_port() const noexcept {
+    return uri_parts_.has(detail::uri_component::port);
+  }
+
+  /**
+   * \brief Returns the URI port.
+   * \return The port.
+   * \pre has_port()
+   */
+  constexpr string_view port() const noexcept {
+    return uri_parts_.get(uri_.data(), detail::uri_component::port);
+  }
+
+  /**
+   * \brief Tests whether this URI has a path component.
+   * \return \c true if the URI has a path, \c false otherwise.
+   */
+  constexpr bool has_path() const noexcept {
+    return uri_parts_.has(detail::uri_component::path);
+  }
+
+  /**
+   * \brief Returns the URI path.
+   * \return The path.
+   * \pre has_path()
+   */
+  constexpr string_view path() const noexcept {
+    return uri_parts_.get(uri_.data(), detail::uri_component::path);
+  }
+
+  /**
+   * \brief Tests whether this URI has a query component.
+   * \return \c true if the URI has a query, \c false otherwise.
+   */
+  constexpr bool has_query() const noexcept {
+    return uri_parts_.has(detail::uri_component::query);
+  }
+
+  /**
+   * \brief Returns the URI query.
+   * \return The query.
+   * \pre has_query()
+   */
+  constexpr string_view query() const noexcept {
+    return uri_parts_.get(uri_.data(), detail::uri_component::query);
+  }
+
+  /**
+   * \brief Returns an iterator to the first key-value pair in the query
+   *        component.
+   *
+   * \return query_iterator.
+   */
+  query_iterator query_begin() const noexcept;
+
+  /**
+   * \brief Returns an iterator to the last key-value pair in the query
+   *        component.
+   *
+   * \return query_iterator.
+   */
+  query_iterator query_end() const noexcept;
+
+  /**
+   * \brief Tests whether this URI has a fragment component.
+   * \return \c true if the URI has a fragment, \c false otherwise.
+   */
+  constexpr bool has_fragment() const noexcept {
+    return uri_parts_.has(detail::uri_component::fragment);
+  }
+
+  /**
+   * \brief Returns the URI fragment.
+   * \return The fragment.
+   * \pre has_fragment()
+   */
+  constexpr string_view fragment() const noexcept {
+    return uri_parts_.get(uri_.data(), detail::uri_component::fragment);
+  }
+
+  /**
+   * \brief Tests whether this URI has a valid authority.
+   * \return \c true if the URI has an authority, \c false otherwise.
+   */
+  constexpr bool has_authority() const noexcept { return has_host(); }
+
+  /**
+   * \brief Returns the URI authority.
+   * \return The authority.
+   */
+  string_view authority() const noexcept;
+
+  /**
+   * \brief Returns the URI as a std::string object.
+   * \returns A URI string.
+   */
+  std::string string() const;
+
+  /**
+   * \brief Returns the URI as a string_view object.
+   * \returns A URI string view.
+   */
+  constexpr string_view view() const noexcept { return uri_; }
+
+  /**
+   * \brief Returns a hash of the URI as if it had been normalized at a
+   *        given level in the comparison ladder, without normalizing
+   *        it.
+   * \param level The comparison level.
+   * \returns The hash, which is the same as uri::hash(level).
+   */
+  std::size_t hash(uri_comparison_level level) const noexcept {
+    return detail::hash_normalized(uri_, uri_parts_, level);
+  }
+
+  /**
+   * \brief Checks if the uri_view object is empty, i.e. it has no
+   *        parts.
+   * \returns \c true if there are no parts, \c false otherwise.
+   */
+  constexpr bool empty() const noexcept { return uri_.empty(); }
+
+  /**
+   * \brief Checks if the uri is absolute, i.e. it has a scheme.
+   * \returns \c true if it is absolute, \c false if it is relative.
+   */
+  constexpr bool is_absolute() const noexcept { return has_scheme(); }
+
+  /**
+   * \brief Checks if the uri is opaque, i.e. if it doesn't have an
+   *        authority.
+   * \returns \c true if it is opaque, \c false if it is hierarchical.
+   */
+  constexpr bool is_opaque() const noexcept {
+    return (is_absolute() && !has_authority());
+  }
+
+ private:
+  constexpr uri_view(string_view uri,
+                     const detail::compact_uri_parts &parts) noexcept
+      : uri_(uri), uri_parts_(parts) {}
+
+  bool initialize(string_view uri) noexcept;
+
+  string_view uri_;
+  detail::compact_uri_parts uri_parts_;
+};
+
+/**
+ * \brief Equality operator for the \c uri_view.
+ */
+inline bool operator==(const uri_view &lhs, const uri_view &rhs) noexcept {
+  return lhs.view() == rhs.view();
+}
+
+/**
+ * \brief Inequality operator for the \c uri_view.
+ */
+inline bool operator!=(const uri_view &lhs, const uri_view &rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+namespace detail {
+// Records the offsets of the components of a URI literal.
+struct uri_literal_handler {
+  NETWORK_URI_CXX14_CONSTEXPR void operator()(uri_component c,
+                                              std::size_t first,
+                                              std::size_t last) noexcept {
+    parts.set(c, static_cast<compact_uri_parts::offset_type>(first),
+              static_cast<compact_uri_parts::offset_type>(last));
+  }
+
+  compact_uri_parts parts;
+};
+}  // namespace detail
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+inline namespace literals {
+inline namespace uri_literals {
+/**
+ * \brief A uri_view literal.
+ *
+ * With C++ 14 or later, the literal is parsed when the program is
+ * compiled if it is used to initialize a \c constexpr variable, and an
+ * invalid URI is a compile error. Otherwise, it is parsed at run time.
+ * Unlike the uri_view constructor, whitespace is not ignored.
+ *
+ * Example:
+ *
+ * \code
+ * using namespace network::uri_literals;
+ * constexpr auto endpoint = "https://api.example.com/v1/"_uri;
+ * \endcode
+ *
+ * \param source The URI.
+ * \param length The length of the URI.
+ * \returns A uri_view of the literal.
+ * \throws uri_syntax_error if the literal is not a valid URI.
+ */
+inline NETWORK_URI_CXX14_CONSTEXPR uri_view operator"" _uri(const char *source,
+                                                           std::size_t length) {
+  uri_incremental_parser parser;
+  detail::uri_literal_handler handler{};
+  const string_view uri(source, length);
+  return (parser.feed(uri, handler) && parser.finish(handler))
+             ? uri_view(uri, handler.parts)
+             : throw uri_syntax_error();
+}
+}  // namespace uri_literals
+}  // namespace literals
+}  // namespace network
+
+#if !defined(DOXYGEN_SHOULD_SKIP_THIS)
+namespace std {
+template <>
+struct hash<network::uri_view> {
+  std::size_t operator()(const network::uri_view &uri_) const noexcept {
+    return network::detail::hash_string(uri_.view());
+  }
+};
+}  // namespace std
+#endif  // !defined(DOXYGEN_SHOULD_SKIP_THIS)
+
+#ifdef NETWORK_URI_MSVC
+#pragma warning(pop)
+#endif
+
+#endif  // NETWORK_URI_URI_VIEW_INC
@@ -0,0 +1,180 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <memory>
+#include <utility>
+#include "network/uri/cached_uri.hpp"
+#include "detail/uri_normalize.hpp"
+
+namespace network {
+namespace {
+// Marks a level at which the URI can't be normalized, because its path
+// has a ".." segment with nothing to remove, so that it isn't tried again.
+const uri *unnormalizable() noexcept {
+  static const uri marker;
+  return &marker;
+}
+}  // namespace
+
+cached_uri::cached_uri() : hash_(uri_.hash()) {
+  for (auto &normalized : normalized_) {
+    normalized.store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+cached_uri::cached_uri(uri instance)
+    : uri_(std::move(instance)), hash_(uri_.hash()) {
+  for (auto &normalized : normalized_) {
+    normalized.store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+cached_uri::cached_uri(const cached_uri &other)
+    : uri_(other.uri_), hash_(other.hash_) {
+  // only the knowledge that the URI is normalized, or can't be, is
+  // copied
+  for (std::size_t i = 0; i < level_count; ++i) {
+    auto normalized = other.normalized_[i].load(std::memory_order_acquire);
+    if (normalized == &other.uri_) {
+      normalized = &uri_;
+    } else if (normalized != unnormalizable()) {
+      normalized = nullptr;
+    }
+    normalized_[i].store(normalized, std::memory_order_relaxed);
+  }
+}
+
+cached_uri::cached_uri(cached_uri &&other) noexcept
+    : uri_(std::move(other.uri_)), hash_(other.hash_) {
+  other.hash_ = other.uri_.hash();
+  for (std::size_t i = 0; i < level_count; ++i) {
+    const auto normalized = other.normalized_[i].exchange(nullptr);
+    normalized_[i].store((normalized == &other.uri_) ? &uri_ : normalized,
+                         std::memory_order_relaxed);
+  }
+}
+
+cached_uri &cached_uri::operator=(cached_uri other) noexcept {
+  swap(other);
+  return *this;
+}
+
+cached_uri::~cached_uri() { release(); }
+
+void cached_uri::swap(cached_uri &other) noexcept {
+  uri_.swap(other.uri_);
+  std::swap(hash_, other.hash_);
+  for (std::size_t i = 0; i < level_count; ++i) {
+    auto normalized = normalized_[i].load(std::memory_order_relaxed);
+    auto other_normalized =
+        other.normalized_[i].load(std::memory_order_relaxed);
+    // a URI that is already normalized stays that way after the swap
+    normalized_[i].store(
+        (other_normalized == &other.uri_) ? &uri_ : other_normalized,
+        std::memory_order_relaxed);
+    other.normalized_[i].store(
+        (normalized == &uri_) ? &other.uri_ : normalized,
+        std::memory_order_relaxed);
+  }
+}
+
+const uri &cached_uri::normalize(uri_comparison_level level) const {
+  if (uri_comparison_level::string_comparison == level) {
+    return uri_;
+  }
+
+  auto normalized = normalized_[index(level)].load(std::memory_order_acquire);
+  if (normalized == nullptr) {
+    normalized = store_normalized(level);
+  }
+  if (normalized == unnormalizable()) {
+    throw uri_builder_error();
+  }
+  return *normalized;
+}
+
+std::size_t cached_uri::hash(uri_comparison_level level) const noexcept {
+  if (uri_comparison_level::string_comparison == level) {
+    return hash_;
+  }
+
+  // the normalized uri is hashed without normalizing it again
+  const auto normalized = find(level);
+  if (normalized == &uri_) {
+    return hash_;
+  }
+  return (normalized != nullptr) ? normalized->hash() : uri_.hash(level);
+}
+
+int cached_uri::compare(const cached_uri &other,
+                        uri_comparison_level level) const noexcept {
+  const auto normalized = find(level), other_normalized = other.find(level);
+  if ((normalized == nullptr) || (other_normalized == nullptr)) {
+    return uri_.compare(other.uri_, level);
+  }
+
+  const auto result = normalized->view().compare(other_normalized->view());
+  return (result < 0) ? -1 : ((result > 0) ? 1 : 0);
+}
+
+std::size_t cached_uri::index(uri_comparison_level level) noexcept {
+  return (uri_comparison_level::syntax_based == level) ? 0 : 1;
+}
+
+const uri *cached_uri::store_normalized(uri_comparison_level level) const {
+  std::unique_ptr<uri> computed;
+  const uri *normalized = nullptr;
+  if (detail::is_normalized(uri_.view(), uri_.uri_parts_, level)) {
+    normalized = &uri_;
+  } else {
+    computed.reset(new uri());
+    normalized = detail::normalize_uri(uri_.uri_, uri_.uri_parts_, level,
+                                       computed->uri_, computed->uri_parts_)
+                     ? computed.get()
+                     : unnormalizable();
+  }
+
+  // another thread may have got there first
+  auto &slot = normalized_[index(level)];
+  const uri *expected = nullptr;
+  if (slot.compare_exchange_strong(expected, normalized,
+                                   std::memory_order_acq_rel,
+                                   std::memory_order_acquire)) {
+    if (normalized == computed.get()) {
+      computed.release();
+    }
+    return normalized;
+  }
+  return expected;
+}
+
+const uri *cached_uri::find(uri_comparison_level level) const noexcept {
+  if (uri_comparison_level::string_comparison == level) {
+    return &uri_;
+  }
+
+  auto normalized = normalized_[index(level)].load(std::memory_order_acquire);
+  if (normalized == nullptr) {
+    try {
+      normalized = store_normalized(level);
+    } catch (...) {
+      // there isn't the memory to normalize it now, but it can still be
+      // compared
+      return nullptr;
+    }
+  }
+  // a URI that can't be normalized is compared without normalizing it
+  return (normalized != unnormalizable()) ? normalized : nullptr;
+}
+
+void cached_uri::release() noexcept {
+  for (auto &normalized : normalized_) {
+    const auto instance = normalized.exchange(nullptr);
+    if ((instance != &uri_) && (instance != unnormalizable())) {
+      delete instance;
+    }
+  }
+}
+}  // namespace network
@@ -10,8 +10,8 @@
 #include <iterator>
 #include <utility>
 #include <string>
-#include <cctype>
-#include <locale>
+#include <network/string_view.hpp>
+#include <network/uri/detail/grammar.hpp>
 
 namespace network {
 namespace detail {
@@ -42,27 +42,24 @@ inline void remove_erase_if(Rng &rng, Pred &&pred) {
   rng.erase(it, last);
 }
 
-inline std::string trim_front(const std::string &str) {
+// Trims the view without copying the string it refers to.
+inline string_view trim_view(string_view str) {
   auto first = std::begin(str), last = std::end(str);
-  auto it = std::find_if(
-      first, last, [](char ch) { return !std::isspace(ch, std::locale()); });
-  return std::string(it, last);
+  while ((first != last) && is_space_char(*first)) {
+    ++first;
+  }
+  while ((last != first) && is_space_char(*(last - 1))) {
+    --last;
+  }
+  return string_view(first, std::distance(first, last));
 }
 
-inline std::string trim_back(const std::string &str) {
-  using reverse_iterator = std::reverse_iterator<std::string::const_iterator>;
-
-  auto first = reverse_iterator(std::end(str)),
-       last = reverse_iterator(std::begin(str));
-  auto it = std::find_if(
-      first, last, [](char ch) { return !std::isspace(ch, std::locale()); });
-  std::string result(it, last);
-  std::reverse(std::begin(result), std::end(result));
-  return result;
-}
-
-inline std::string trim_copy(const std::string &str) {
-  return trim_back(trim_front(str));
+// Trims the string in its own buffer, without allocating.
+inline void trim_in_place(std::string &str) {
+  auto trimmed = trim_view(str);
+  const auto first = static_cast<std::size_t>(trimmed.data() - str.data());
+  str.erase(first + trimmed.size());
+  str.erase(0, first);
 }
 }  // namespace detail
 }  // namespace network
@@ -0,0 +1,229 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "uri_host.hpp"
+
+using network::string_view;
+namespace network_detail = network::detail;
+
+namespace {
+int hex_digit_value(char c) noexcept {
+  if (network_detail::is_digit_char(c)) {
+    return c - '0';
+  }
+  const auto lower = network_detail::to_lower_char(c);
+  return ((lower >= 'a') && (lower <= 'f')) ? lower - 'a' + 10 : -1;
+}
+
+// Reads an IPv4 address as RFC 3986 writes it, in dotted decimal with no
+// leading zeros. A resolver might read a part with a leading zero as
+// octal (RFC 3986 section 7.4), so any other dotted quad is a reg-name.
+bool parse_ipv4(const char *first, const char *last,
+                unsigned char (&octets)[4]) noexcept {
+  for (std::size_t i = 0; i < 4; ++i) {
+    if ((i != 0) && ((first == last) || (*first++ != '.'))) {
+      return false;
+    }
+    if ((first == last) || !network_detail::is_digit_char(*first)) {
+      return false;
+    }
+    const auto part = first;
+    unsigned value = 0;
+    while ((first != last) && network_detail::is_digit_char(*first)) {
+      if ((first != part) && (*part == '0')) {
+        return false;
+      }
+      value = (value * 10) + static_cast<unsigned>(*first++ - '0');
+      if (value > 255) {
+        return false;
+      }
+    }
+    octets[i] = static_cast<unsigned char>(value);
+  }
+  return first == last;
+}
+
+// Reads the eight groups of an IPv6 address, without its brackets.
+bool parse_ipv6(const char *first, const char *last,
+                unsigned (&groups)[8]) noexcept {
+  unsigned parsed[8];
+  std::size_t count = 0, compressed = 8;
+  if ((last - first >= 2) && (first[0] == ':') && (first[1] == ':')) {
+    compressed = 0;
+    first += 2;
+  }
+
+  while (first != last) {
+    if (count == 8) {
+      return false;
+    }
+
+    const auto group = first;
+    unsigned value = 0;
+    for (; (first != last) && (first - group < 4); ++first) {
+      const auto digit = hex_digit_value(*first);
+      if (digit < 0) {
+        break;
+      }
+      value = (value * 16) + static_cast<unsigned>(digit);
+    }
+    if (first == group) {
+      return false;
+    }
+
+    // an IPv4 address can only be the last two groups
+    if ((first != last) && (*first == '.')) {
+      unsigned char octets[4];
+      if ((count > 6) || !parse_ipv4(group, last, octets)) {
+        return false;
+      }
+      parsed[count++] = (octets[0] * 256u) + octets[1];
+      parsed[count++] = (octets[2] * 256u) + octets[3];
+      first = last;
+      break;
+    }
+
+    parsed[count++] = value;
+    if (first == last) {
+      break;
+    }
+    if ((*first++ != ':') || (first == last)) {
+      return false;
+    }
+    if (*first == ':') {
+      if (compressed != 8) {
+        return false;
+      }
+      compressed = count;
+      ++first;
+    }
+  }
+
+  // "::" stands for at least one zero group
+  if ((compressed == 8) ? (count != 8) : (count == 8)) {
+    return false;
+  }
+
+  const auto zeros = 8 - count;
+  for (std::size_t i = 0, j = 0; i < 8; ++i) {
+    groups[i] = ((i >= compressed) && (i < compressed + zeros))
+                    ? 0
+                    : parsed[j++];
+  }
+  return true;
+}
+
+char *write_decimal(unsigned value, char *out) noexcept {
+  if (value >= 100) {
+    *out++ = static_cast<char>('0' + (value / 100));
+  }
+  if (value >= 10) {
+    *out++ = static_cast<char>('0' + ((value / 10) % 10));
+  }
+  *out++ = static_cast<char>('0' + (value % 10));
+  return out;
+}
+
+char *write_ipv4(const unsigned char (&octets)[4], char *out) noexcept {
+  for (std::size_t i = 0; i < 4; ++i) {
+    if (i != 0) {
+      *out++ = '.';
+    }
+    out = write_decimal(octets[i], out);
+  }
+  return out;
+}
+
+// Writes a group in lower case hexadecimal, without leading zeros.
+char *write_group(unsigned value, char *out) noexcept {
+  const char digits[] = "0123456789abcdef";
+  auto shift = 12;
+  while ((shift > 0) && ((value >> shift) == 0)) {
+    shift -= 4;
+  }
+  for (; shift >= 0; shift -= 4) {
+    *out++ = digits[(value >> shift) & 0xf];
+  }
+  return out;
+}
+
+char *write_ipv6(const unsigned (&groups)[8], char *out) noexcept {
+  *out++ = '[';
+
+  // an IPv4 mapped address ends in dotted decimal, as RFC 5952 section
+  // 5 recommends
+  if ((groups[0] == 0) && (groups[1] == 0) && (groups[2] == 0) &&
+      (groups[3] == 0) && (groups[4] == 0) && (groups[5] == 0xffff)) {
+    const char prefix[] = "::ffff:";
+    for (std::size_t i = 0; i < sizeof(prefix) - 1; ++i) {
+      *out++ = prefix[i];
+    }
+    const unsigned char octets[4] = {
+        static_cast<unsigned char>(groups[6] >> 8),
+        static_cast<unsigned char>(groups[6] & 0xff),
+        static_cast<unsigned char>(groups[7] >> 8),
+        static_cast<unsigned char>(groups[7] & 0xff)};
+    out = write_ipv4(octets, out);
+    *out++ = ']';
+    return out;
+  }
+
+  // the first of the longest runs of two or more zero groups is
+  // compressed
+  std::size_t run_first = 8, run_size = 1;
+  for (std::size_t i = 0; i < 8;) {
+    if (groups[i] != 0) {
+      ++i;
+      continue;
+    }
+    auto j = i;
+    while ((j < 8) && (groups[j] == 0)) {
+      ++j;
+    }
+    if (j - i > run_size) {
+      run_first = i;
+      run_size = j - i;
+    }
+    i = j;
+  }
+
+  for (std::size_t i = 0; i < 8; ++i) {
+    if (i == run_first) {
+      *out++ = ':';
+      *out++ = ':';
+      i += run_size - 1;
+      continue;
+    }
+    if ((i != 0) && (i != run_first + run_size)) {
+      *out++ = ':';
+    }
+    out = write_group(groups[i], out);
+  }
+  *out++ = ']';
+  return out;
+}
+}  // namespace
+
+std::size_t network_detail::canonical_ip_literal(string_view host,
+                                                 char *out) noexcept {
+  if (host.empty()) {
+    return 0;
+  }
+
+  const auto first = host.data(), last = host.data() + host.size();
+  if ((host.front() == '[') && (host.back() == ']')) {
+    unsigned groups[8];
+    if (!parse_ipv6(first + 1, last - 1, groups)) {
+      return 0;
+    }
+    return static_cast<std::size_t>(write_ipv6(groups, out) - out);
+  }
+
+  unsigned char octets[4];
+  if (!is_digit_char(host.front()) || !parse_ipv4(first, last, octets)) {
+    return 0;
+  }
+  return static_cast<std::size_t>(write_ipv4(octets, out) - out);
+}
@@ -0,0 +1,82 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NETWORK_DETAIL_URI_HOST_INC
+#define NETWORK_DETAIL_URI_HOST_INC
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <network/string_view.hpp>
+#include <network/uri/detail/grammar.hpp>
+
+namespace network {
+namespace detail {
+// Hosts are lower case a word at a time. Each byte of the word is
+// checked at once, without a branch, and bytes that aren't ASCII are
+// left alone.
+namespace ascii_word {
+const std::uint64_t ones = 0x0101010101010101ull;
+const std::uint64_t high_bits = 0x8080808080808080ull;
+
+inline std::uint64_t load(const char *p) noexcept {
+  std::uint64_t word;
+  std::memcpy(&word, p, sizeof(word));
+  return word;
+}
+
+inline void store(char *p, std::uint64_t word) noexcept {
+  std::memcpy(p, &word, sizeof(word));
+}
+
+// Returns a word with the high bit set in each byte that is an upper
+// case ASCII letter. The seven low bits of each byte are offset so that
+// the high bit is set at 'A' and again after 'Z', and no byte carries
+// into the next.
+inline std::uint64_t upper_case_bytes(std::uint64_t word) noexcept {
+  const auto low_bits = word & ~high_bits;
+  const auto from_a = low_bits + (ones * (0x80 - 'A'));
+  const auto after_z = low_bits + (ones * (0x80 - 'Z' - 1));
+  return ~word & from_a & ~after_z & high_bits;
+}
+
+inline std::uint64_t to_lower(std::uint64_t word) noexcept {
+  // the high bit of each upper case byte becomes its 0x20 bit
+  return word | (upper_case_bytes(word) >> 2);
+}
+
+// Returns true if any byte in the word is c.
+inline bool contains(std::uint64_t word, char c) noexcept {
+  const auto bytes = word ^ (ones * static_cast<unsigned char>(c));
+  return ((bytes - ones) & ~bytes & high_bits) != 0;
+}
+}  // namespace ascii_word
+
+// Makes the ASCII letters in the range lower case.
+inline void to_lower_in_place(char *first, std::size_t size) noexcept {
+  for (; size >= 8; first += 8, size -= 8) {
+    ascii_word::store(first, ascii_word::to_lower(ascii_word::load(first)));
+  }
+  for (; size > 0; ++first, --size) {
+    *first = to_lower_char(*first);
+  }
+}
+
+// The longest IP literal in its canonical form, which is an IPv6
+// address with no zero groups, in brackets.
+const std::size_t max_ip_literal_size = 41;
+
+// If the host is an IPv6 address in brackets or an IPv4 address,
+// writes its canonical form to out and returns its size, and otherwise
+// returns 0. An IPv6 address is written as RFC 5952 recommends, in
+// lower case hexadecimal with the longest run of zero groups
+// compressed. An IPv4 address is only found if it has no leading
+// zeros, so it is already canonical. The canonical form is at most
+// max_ip_literal_size, and can be longer than the host.
+std::size_t canonical_ip_literal(string_view host, char *out) noexcept;
+}  // namespace detail
+}  // namespace network
+
+#endif  // NETWORK_DETAIL_URI_HOST_INC
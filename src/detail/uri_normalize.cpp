@@ -6,51 +6,62 @@
 #include "uri_normalize.hpp"
 #include "uri_percent_encode.hpp"
 #include "algorithm.hpp"
-#include "algorithm_split.hpp"
+#include <network/uri/detail/grammar.hpp>
+#include <network/uri/uri_schemes.hpp>
+#include <algorithm>
+#include <cstring>
 #include <iterator>
-#include <vector>
 
-using namespace network::algorithm;
 using network::string_view;
 using network::uri_comparison_level;
 namespace network_detail = network::detail;
 
-std::string network_detail::normalize_path_segments(string_view path) {
-  std::string result;
-
-  if (!path.empty()) {
-    std::vector<std::string> path_segments;
-    split(path_segments, path, '/');
-
-    bool last_segment_is_slash = path_segments.back().empty();
-    std::vector<std::string> normalized_segments;
-    for (const auto &segment : path_segments) {
-      if (segment.empty() || (segment == ".")) {
-        continue;
-      } else if (segment == "..") {
-        if (normalized_segments.empty()) {
-          throw uri_builder_error();
-        }
-        normalized_segments.pop_back();
+bool network_detail::normalize_path_segments(std::string &path) {
+  // each segment is written with the slash before it, so the path is
+  // never longer than it was once it starts with a slash
+  if (path.empty() || (path.front() != '/')) {
+    path.insert(0, 1, '/');
+  }
+
+  char *data = &path[0];
+  const auto size = path.size();
+  std::size_t segments[max_segment_depth];
+  std::size_t it = 0, depth = 0;
+  for (std::size_t first = 1; first <= size;) {
+    const auto slash =
+        static_cast<char *>(std::memchr(data + first, '/', size - first));
+    const auto last = (slash != nullptr) ? std::size_t(slash - data) : size;
+    const auto length = last - first;
+    if ((length == 2) && (data[first] == '.') && (data[first + 1] == '.')) {
+      if (depth == 0) {
+        return false;
+      }
+      // a segment that is too deep to be on the stack is found by
+      // looking back for its slash
+      if (--depth < max_segment_depth) {
+        it = segments[depth];
       } else {
-        normalized_segments.push_back(segment);
+        do {
+          --it;
+        } while (data[it] != '/');
       }
+    } else if ((length > 1) || ((length == 1) && (data[first] != '.'))) {
+      if (depth < max_segment_depth) {
+        segments[depth] = it;
+      }
+      ++depth;
+      data[it++] = '/';
+      std::memmove(data + it, data + first, length);
+      it += length;
     }
-
-    for (const auto &segment : normalized_segments) {
-      result += "/" + segment;
-    }
-
-    if (last_segment_is_slash) {
-      result += "/";
-    }
+    first = last + 1;
   }
 
-  if (result.empty()) {
-    result = "/";
+  if ((it == 0) || (data[size - 1] == '/')) {
+    data[it++] = '/';
   }
-
-  return result;
+  path.resize(it);
+  return true;
 }
 
 std::string network_detail::normalize_path(string_view path,
@@ -67,8 +78,661 @@ std::string network_detail::normalize_path(string_view path,
                  std::end(result));
 
     // % path segment normalization
-    result = normalize_path_segments(result);
+    if (!normalize_path_segments(result)) {
+      throw uri_builder_error();
+    }
   }
 
   return result;
 }
+
+namespace {
+int hex_value(char c) noexcept {
+  if ((c >= '0') && (c <= '9')) {
+    return c - '0';
+  }
+  if ((c >= 'a') && (c <= 'f')) {
+    return c - 'a' + 10;
+  }
+  if ((c >= 'A') && (c <= 'F')) {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+// Returns the octet that is percent encoded at first, or -1.
+int decode_octet(const char *first, const char *last) noexcept {
+  if ((last - first < 3) || (*first != '%')) {
+    return -1;
+  }
+  const auto high = hex_value(first[1]), low = hex_value(first[2]);
+  return ((high < 0) || (low < 0)) ? -1 : (high * 16) + low;
+}
+
+// Returns 1 for a "." segment and 2 for a "..", which may be percent
+// encoded, and 0 for any other segment.
+unsigned dot_segment(const char *first, const char *last) noexcept {
+  unsigned dots = 0;
+  while (first != last) {
+    if (*first == '.') {
+      ++first;
+    } else if (decode_octet(first, last) == '.') {
+      first += 3;
+    } else {
+      return 0;
+    }
+    if (++dots > 2) {
+      return 0;
+    }
+  }
+  return dots;
+}
+}  // namespace
+
+bool network_detail::is_default_port(string_view scheme,
+                                     string_view port) noexcept {
+  while ((port.size() > 1) && (port.front() == '0')) {
+    port.remove_prefix(1);
+  }
+  if (port.empty()) {
+    return true;
+  }
+  const auto default_port = find_default_port(scheme);
+  return default_port && (*default_port == port);
+}
+
+network_detail::uri_normalizer::uri_normalizer(
+    string_view uri, const compact_uri_parts &parts,
+    uri_comparison_level level) noexcept
+    : uri_(uri.data()),
+      size_(uri.size()),
+      path_first_(parts.has(uri_component::path)
+                      ? parts.first(uri_component::path)
+                      : uri.size()),
+      path_last_(parts.has(uri_component::path)
+                     ? parts.last(uri_component::path)
+                     : uri.size()),
+      is_normal_(!parts.has(uri_component::path) ||
+                 ((path_first_ < path_last_) && (uri[path_first_] == '/'))),
+      has_dot_dot_(false),
+      has_unmatched_(false),
+      has_segment_(false),
+      separator_(false),
+      lower_case_(false),
+      state_(state::end),
+      it_(0),
+      last_(0),
+      segment_(path_first_),
+      host_size_(0),
+      region_count_(0),
+      region_next_(0),
+      kept_count_(0),
+      kept_next_(0),
+      has_kept_(true) {
+  std::size_t depth = 0;
+  for (auto first = path_first_; first < path_last_;) {
+    const auto last = segment_last(first);
+    const auto dots = dot_segment(uri_ + first, uri_ + last);
+    if ((dots != 0) || ((first == last) && (first != path_first_))) {
+      is_normal_ = false;
+    }
+    if (dots == 2) {
+      has_dot_dot_ = true;
+      if (depth == 0) {
+        has_unmatched_ = true;
+      } else {
+        --depth;
+      }
+      if (kept_count_ > 0) {
+        --kept_count_;
+      }
+    } else if ((first != last) && (dots == 0)) {
+      ++depth;
+      if (kept_count_ < max_kept) {
+        kept_[kept_count_++] = first;
+      } else {
+        has_kept_ = false;
+      }
+    }
+    first = last + 1;
+  }
+
+  std::size_t it = 0;
+  if (parts.has(uri_component::scheme)) {
+    it = parts.last(uri_component::scheme);
+    add_region(0, it, region_kind::lower_case);
+  }
+
+  if (parts.has(uri_component::host)) {
+    const auto host_first = parts.first(uri_component::host);
+    add_region(it, host_first, region_kind::text);
+    it = parts.last(uri_component::host);
+
+    // an IP literal is only read from host_ if its canonical form is
+    // different
+    host_size_ = canonical_ip_literal(
+        string_view(uri_ + host_first, it - host_first), host_);
+    const auto is_canonical =
+        (host_size_ == it - host_first) &&
+        (std::memcmp(host_, uri_ + host_first, host_size_) == 0);
+    add_region(host_first, it,
+               ((host_size_ != 0) && !is_canonical) ? region_kind::host
+                                                    : region_kind::lower_case);
+  }
+
+  // the port is left out with the ':' before it
+  if ((uri_comparison_level::scheme_based == level) &&
+      parts.has(uri_component::port) &&
+      is_default_port(parts.get(uri_, uri_component::scheme),
+                      parts.get(uri_, uri_component::port))) {
+    add_region(it, parts.first(uri_component::port) - 1, region_kind::text);
+    it = parts.last(uri_component::port);
+  }
+
+  // the path is only taken apart if it would be changed
+  if (is_normal_) {
+    add_region(it, size_, region_kind::text);
+  } else {
+    add_region(it, path_first_, region_kind::text);
+    add_region(path_first_, path_last_, region_kind::path);
+    add_region(path_last_, size_, region_kind::text);
+  }
+  next_region();
+}
+
+bool network_detail::uri_normalizer::next(string_view &piece) noexcept {
+  for (;;) {
+    switch (state_) {
+      case state::text:
+        if (read(piece)) {
+          return true;
+        }
+        next_region();
+        break;
+      case state::host:
+        piece = string_view(host_, host_size_);
+        next_region();
+        return true;
+      case state::path_segment:
+        if (separator_) {
+          separator_ = false;
+          piece = string_view("/", 1);
+          return true;
+        }
+        if (read(piece)) {
+          return true;
+        }
+        next_segment();
+        break;
+      case state::path_end:
+        next_region();
+        // an empty path is "/", and a trailing slash is kept
+        if (!has_segment_ || (uri_[path_last_ - 1] == '/')) {
+          piece = string_view("/", 1);
+          return true;
+        }
+        break;
+      case state::end:
+        return false;
+    }
+  }
+}
+
+void network_detail::uri_normalizer::add_region(std::size_t first,
+                                                std::size_t last,
+                                                region_kind kind) noexcept {
+  regions_[region_count_++] = region{first, last, kind};
+}
+
+void network_detail::uri_normalizer::next_region() noexcept {
+  if (region_next_ == region_count_) {
+    state_ = state::end;
+    return;
+  }
+
+  const auto &next = regions_[region_next_++];
+  lower_case_ = (region_kind::lower_case == next.kind);
+  if (region_kind::path == next.kind) {
+    next_segment();
+  } else if (region_kind::host == next.kind) {
+    state_ = state::host;
+  } else {
+    start(state::text, next.first, next.last);
+  }
+}
+
+void network_detail::uri_normalizer::start(state s, std::size_t first,
+                                           std::size_t last) noexcept {
+  state_ = s;
+  it_ = first;
+  last_ = last;
+}
+
+void network_detail::uri_normalizer::next_segment() noexcept {
+  if (has_dot_dot_ && has_kept_) {
+    if (kept_next_ == kept_count_) {
+      state_ = state::path_end;
+      return;
+    }
+    segment_ = kept_[kept_next_++];
+  }
+
+  while (segment_ < path_last_) {
+    const auto first = segment_, last = segment_last(first);
+    segment_ = last + 1;
+    if ((first == last) || (dot_segment(uri_ + first, uri_ + last) != 0)) {
+      continue;
+    }
+    if (has_dot_dot_ && !has_kept_ && !is_kept(last)) {
+      continue;
+    }
+    // the slash before the segment is read with it, if there is one
+    separator_ = (first == path_first_);
+    start(state::path_segment, separator_ ? first : first - 1, last);
+    has_segment_ = true;
+    return;
+  }
+  state_ = state::path_end;
+}
+
+bool network_detail::uri_normalizer::is_kept(std::size_t last) const
+    noexcept {
+  // the segment is removed by the first ".." that isn't matched by a
+  // segment in between, which is only looked for when there are too
+  // many segments to keep track of
+  std::size_t unmatched = 0;
+  for (auto first = last + 1; first < path_last_;) {
+    const auto segment_end = segment_last(first);
+    const auto dots = dot_segment(uri_ + first, uri_ + segment_end);
+    if (dots == 2) {
+      if (unmatched == 0) {
+        return false;
+      }
+      --unmatched;
+    } else if ((first != segment_end) && (dots == 0)) {
+      ++unmatched;
+    }
+    first = segment_end + 1;
+  }
+  return true;
+}
+
+bool network_detail::uri_normalizer::read(string_view &piece) noexcept {
+  if (it_ >= last_) {
+    return false;
+  }
+
+  const auto first = uri_ + it_;
+  if (*first == '%') {
+    const auto octet = decode_octet(first, uri_ + last_);
+    if (octet < 0) {
+      piece = string_view(first, 1);
+      ++it_;
+    } else if (is_unreserved_char(static_cast<unsigned char>(octet))) {
+      buffer_[0] = lower_case_ ? to_lower_char(static_cast<char>(octet))
+                               : static_cast<char>(octet);
+      piece = string_view(buffer_, 1);
+      it_ += 3;
+    } else {
+      buffer_[0] = '%';
+      buffer_[1] = to_upper_char(first[1]);
+      buffer_[2] = to_upper_char(first[2]);
+      piece = string_view(buffer_, 3);
+      it_ += 3;
+    }
+    return true;
+  }
+
+  if (lower_case_) {
+    // the characters up to the next upper case character or percent
+    // encoded octet are unchanged, and are skipped a word at a time
+    auto it = it_;
+    while ((last_ - it >= 8) &&
+           !ascii_word::contains(ascii_word::load(uri_ + it), '%') &&
+           (ascii_word::upper_case_bytes(ascii_word::load(uri_ + it)) ==
+            0)) {
+      it += 8;
+    }
+    while ((it < last_) && (uri_[it] != '%') &&
+           (to_lower_char(uri_[it]) == uri_[it])) {
+      ++it;
+    }
+    if (it != it_) {
+      piece = string_view(first, it - it_);
+      it_ = it;
+      return true;
+    }
+
+    // otherwise the characters up to the next percent encoded octet
+    // are lower cased in the buffer, up to a word at a time
+    std::size_t size = 0;
+    while ((size < sizeof(buffer_)) && (it_ + size < last_) &&
+           (first[size] != '%')) {
+      ++size;
+    }
+    std::memcpy(buffer_, first, size);
+    to_lower_in_place(buffer_, size);
+    piece = string_view(buffer_, size);
+    it_ += size;
+    return true;
+  }
+
+  // the characters up to the next percent encoded octet are unchanged
+  const auto percent =
+      static_cast<const char *>(std::memchr(first, '%', last_ - it_));
+  const auto size =
+      (percent != nullptr) ? std::size_t(percent - first) : last_ - it_;
+  piece = string_view(first, size);
+  it_ += size;
+  return true;
+}
+
+std::size_t network_detail::uri_normalizer::segment_last(
+    std::size_t first) const noexcept {
+  const auto slash = static_cast<const char *>(
+      std::memchr(uri_ + first, '/', path_last_ - first));
+  return (slash != nullptr) ? std::size_t(slash - uri_) : path_last_;
+}
+
+namespace {
+typedef network_detail::compact_uri_parts::offset_type offset_type;
+
+// The parts of a URI, in the order they appear in it.
+const network_detail::uri_component components[] = {
+    network_detail::uri_component::scheme,
+    network_detail::uri_component::user_info,
+    network_detail::uri_component::host,
+    network_detail::uri_component::port,
+    network_detail::uri_component::path,
+    network_detail::uri_component::query,
+    network_detail::uri_component::fragment};
+
+// The delimiters between the parts are unchanged, and a percent encoded
+// octet never crosses one, so each part is normalized on its own.
+network_detail::uri_normalizer part_normalizer(
+    const char *uri, network_detail::uri_component c, std::size_t first,
+    std::size_t last, uri_comparison_level level) noexcept {
+  network_detail::compact_uri_parts parts;
+  if ((network_detail::uri_component::scheme == c) ||
+      (network_detail::uri_component::host == c) ||
+      (network_detail::uri_component::path == c)) {
+    parts.set(c, 0, static_cast<offset_type>(last - first));
+  }
+  return network_detail::uri_normalizer(
+      string_view(uri + first, last - first), parts, level);
+}
+
+// The text between two parts is usually just a delimiter, but the
+// parser can leave more there, such as the "a%7e" in
+// "http://a%7e[::1]/". It's normalized in the same way as the
+// normalizer reads it, which only changes it if it's percent encoded.
+bool is_gap_changed(const char *uri, std::size_t first,
+                    std::size_t last) noexcept {
+  return std::memchr(uri + first, '%', last - first) != nullptr;
+}
+
+network_detail::uri_normalizer gap_normalizer(
+    const char *uri, std::size_t first, std::size_t last,
+    uri_comparison_level level) noexcept {
+  return network_detail::uri_normalizer(
+      string_view(uri + first, last - first),
+      network_detail::compact_uri_parts(), level);
+}
+
+void append_pieces(std::string &normalized,
+                   network_detail::uri_normalizer &normalizer) {
+  string_view piece;
+  while (normalizer.next(piece)) {
+    normalized.append(piece.data(), piece.size());
+  }
+}
+
+void append_gap(std::string &normalized, const char *uri, std::size_t first,
+                std::size_t last, uri_comparison_level level) {
+  if (!is_gap_changed(uri, first, last)) {
+    normalized.append(uri + first, last - first);
+    return;
+  }
+  auto normalizer = gap_normalizer(uri, first, last, level);
+  append_pieces(normalized, normalizer);
+}
+
+// Writes the pieces at size in data, which is no further on than they
+// are read from, and returns the size after them.
+std::size_t move_pieces(char *data, std::size_t size,
+                        network_detail::uri_normalizer &normalizer) noexcept {
+  string_view piece;
+  while (normalizer.next(piece)) {
+    if (piece.data() != data + size) {
+      std::memmove(data + size, piece.data(), piece.size());
+    }
+    size += piece.size();
+  }
+  return size;
+}
+
+std::size_t move_gap(char *data, std::size_t size, std::size_t first,
+                     std::size_t last, uri_comparison_level level) noexcept {
+  if (!is_gap_changed(data, first, last)) {
+    std::memmove(data + size, data + first, last - first);
+    return size + (last - first);
+  }
+  auto normalizer = gap_normalizer(data, first, last, level);
+  return move_pieces(data, size, normalizer);
+}
+
+// Returns true if the port is left out of the normalized URI, along
+// with the ':' before it.
+bool is_port_left_out(const char *uri,
+                      const network_detail::compact_uri_parts &parts,
+                      uri_comparison_level level) noexcept {
+  return (uri_comparison_level::scheme_based == level) &&
+         parts.has(network_detail::uri_component::port) &&
+         network_detail::is_default_port(
+             parts.get(uri, network_detail::uri_component::scheme),
+             parts.get(uri, network_detail::uri_component::port));
+}
+}  // namespace
+
+bool network_detail::normalize_uri(string_view uri,
+                                   const compact_uri_parts &parts,
+                                   uri_comparison_level level,
+                                   std::string &normalized,
+                                   compact_uri_parts &normalized_parts) {
+  const auto is_port_kept = !is_port_left_out(uri.data(), parts, level);
+  normalized.clear();
+  // a slash may be added at the start of the path, and an IP literal
+  // may be a few characters longer in its canonical form
+  normalized.reserve(uri.size() + 1 + max_ip_literal_size);
+  normalized_parts.clear();
+
+  std::size_t it = 0;
+  for (const auto c : components) {
+    if (!parts.has(c)) {
+      continue;
+    }
+
+    const std::size_t first = parts.first(c), last = parts.last(c);
+    if ((uri_component::port == c) && !is_port_kept) {
+      it = last;
+      continue;
+    }
+    append_gap(normalized, uri.data(), it, first, level);
+
+    auto normalizer = part_normalizer(uri.data(), c, first, last, level);
+    if (normalizer.has_unmatched_dot_dot()) {
+      return false;
+    }
+
+    const auto normalized_first = normalized.size();
+    append_pieces(normalized, normalizer);
+    normalized_parts.set(c, static_cast<offset_type>(normalized_first),
+                         static_cast<offset_type>(normalized.size()));
+    it = last;
+  }
+  append_gap(normalized, uri.data(), it, uri.size(), level);
+  return true;
+}
+
+bool network_detail::normalize_uri_in_place(std::string &uri,
+                                            compact_uri_parts &parts,
+                                            uri_comparison_level level) {
+  // An IPv6 address can be longer in its canonical form, if "::" stands
+  // for a single group or an IPv4-mapped address was written in hex.
+  // This is rare enough that the URI is normalized into a new string.
+  if (parts.has(uri_component::host)) {
+    const auto host = parts.get(uri.data(), uri_component::host);
+    char canonical[max_ip_literal_size];
+    if (canonical_ip_literal(host, canonical) > host.size()) {
+      std::string normalized;
+      compact_uri_parts normalized_parts;
+      if (!normalize_uri(uri, parts, level, normalized, normalized_parts)) {
+        return false;
+      }
+      uri.swap(normalized);
+      parts = normalized_parts;
+      return true;
+    }
+  }
+
+  const auto is_port_kept = !is_port_left_out(uri.data(), parts, level);
+  const auto has_path = parts.has(uri_component::path);
+  std::size_t path_first = has_path ? parts.first(uri_component::path) : 0,
+              path_last = has_path ? parts.last(uri_component::path) : 0;
+
+  // The normalized URI is only longer when a slash is added at the
+  // start of the path, so that slash is inserted first. The normalizer
+  // treats "/a" the same as "a", and after that each piece is written
+  // no further on than it was read from.
+  if (has_path && ((path_first == path_last) || (uri[path_first] != '/'))) {
+    if (part_normalizer(uri.data(), uri_component::path, path_first,
+                        path_last, level)
+            .has_unmatched_dot_dot()) {
+      return false;
+    }
+
+    uri.insert(path_first, 1, '/');
+    compact_uri_parts inserted;
+    offset_type shift = 0;
+    for (const auto c : components) {
+      if (uri_component::path == c) {
+        inserted.set(c, static_cast<offset_type>(path_first),
+                     static_cast<offset_type>(++path_last));
+        shift = 1;
+      } else if (parts.has(c)) {
+        inserted.set(c, parts.first(c) + shift, parts.last(c) + shift);
+      }
+    }
+    parts = inserted;
+  }
+
+  // the path is checked before anything is written
+  char *data = &uri[0];
+  auto path_normalizer = part_normalizer(data, uri_component::path,
+                                         path_first, path_last, level);
+  if (path_normalizer.has_unmatched_dot_dot()) {
+    return false;
+  }
+
+  compact_uri_parts normalized_parts;
+  std::size_t it = 0, size = 0;
+  for (const auto c : components) {
+    if (!parts.has(c)) {
+      continue;
+    }
+
+    const std::size_t first = parts.first(c), last = parts.last(c);
+    if ((uri_component::port == c) && !is_port_kept) {
+      it = last;
+      continue;
+    }
+    size = move_gap(data, size, it, first, level);
+
+    auto normalizer = (uri_component::path == c)
+                          ? path_normalizer
+                          : part_normalizer(data, c, first, last, level);
+    const auto normalized_first = size;
+    size = move_pieces(data, size, normalizer);
+    normalized_parts.set(c, static_cast<offset_type>(normalized_first),
+                         static_cast<offset_type>(size));
+    it = last;
+  }
+  size = move_gap(data, size, it, uri.size(), level);
+  uri.resize(size);
+  parts = normalized_parts;
+  return true;
+}
+
+std::size_t network_detail::hash_normalized(
+    string_view uri, const compact_uri_parts &parts,
+    uri_comparison_level level) noexcept {
+  if (uri_comparison_level::string_comparison == level) {
+    return hash_string(uri);
+  }
+
+  incremental_hash hash;
+  uri_normalizer normalizer(uri, parts, level);
+  string_view piece;
+  while (normalizer.next(piece)) {
+    hash.append(piece.data(), piece.size());
+  }
+  return static_cast<std::size_t>(hash.finish());
+}
+
+int network_detail::compare_normalized(string_view lhs,
+                                       const compact_uri_parts &lhs_parts,
+                                       string_view rhs,
+                                       const compact_uri_parts &rhs_parts,
+                                       uri_comparison_level level) noexcept {
+  // a URI is always normalized to the same string
+  if ((uri_comparison_level::string_comparison == level) || (lhs == rhs)) {
+    const auto result = lhs.compare(rhs);
+    return (result < 0) ? -1 : ((result > 0) ? 1 : 0);
+  }
+
+  // the pieces of each URI are compared until they differ, and a piece
+  // that is longer than the other is compared with the next piece
+  uri_normalizer lhs_normalizer(lhs, lhs_parts, level);
+  uri_normalizer rhs_normalizer(rhs, rhs_parts, level);
+  string_view lhs_piece, rhs_piece;
+  auto has_lhs = lhs_normalizer.next(lhs_piece);
+  auto has_rhs = rhs_normalizer.next(rhs_piece);
+  while (has_lhs && has_rhs) {
+    const auto size = std::min(lhs_piece.size(), rhs_piece.size());
+    const auto result = std::memcmp(lhs_piece.data(), rhs_piece.data(), size);
+    if (result != 0) {
+      return (result < 0) ? -1 : 1;
+    }
+
+    lhs_piece.remove_prefix(size);
+    rhs_piece.remove_prefix(size);
+    if (lhs_piece.empty()) {
+      has_lhs = lhs_normalizer.next(lhs_piece);
+    }
+    if (rhs_piece.empty()) {
+      has_rhs = rhs_normalizer.next(rhs_piece);
+    }
+  }
+  return has_lhs ? 1 : (has_rhs ? -1 : 0);
+}
+
+bool network_detail::is_normalized(string_view uri,
+                                   const compact_uri_parts &parts,
+                                   uri_comparison_level level) noexcept {
+  if (uri_comparison_level::string_comparison == level) {
+    return true;
+  }
+
+  // an unmatched ".." is ignored by the normalizer, so it doesn't
+  // read the URI as it is
+  uri_normalizer normalizer(uri, parts, level);
+  string_view piece;
+  while (normalizer.next(piece)) {
+    if ((piece.size() > uri.size()) ||
+        (std::memcmp(piece.data(), uri.data(), piece.size()) != 0)) {
+      return false;
+    }
+    uri.remove_prefix(piece.size());
+  }
+  return uri.empty();
+}
@@ -6,14 +6,126 @@
 #ifndef NETWORK_DETAIL_NORMALIZE_INC
 #define NETWORK_DETAIL_NORMALIZE_INC
 
+#include <cstddef>
+#include <string>
 #include <network/uri/uri.hpp>
 #include <network/string_view.hpp>
+#include <network/uri/detail/uri_parts.hpp>
+#include "uri_host.hpp"
 
 namespace network {
 namespace detail {
-std::string normalize_path_segments(string_view path);
+// The number of segments whose offsets are kept on the stack when dot
+// segments are removed from a path. Deeper segments are found again by
+// looking back through the path.
+const std::size_t max_segment_depth = 32;
+
+// Removes the empty, "." and ".." segments from the path in its own
+// buffer, and keeps a trailing slash. The path only allocates if it
+// doesn't start with a slash and there's no room for one. Returns
+// false, and leaves the path unspecified, if a ".." segment has
+// nothing to remove.
+bool normalize_path_segments(std::string &path);
 
 std::string normalize_path(string_view path, uri_comparison_level level);
+
+// Returns true if the port is left out of a URI at the scheme_based
+// level, because it's empty or it's the default port of the scheme.
+bool is_default_port(string_view scheme, string_view port) noexcept;
+
+// Reads a URI a piece at a time as uri::normalize would write it,
+// without allocating. At the syntax_based level, the scheme and the
+// host are lower case, an IP literal is written in its canonical form,
+// percent encoded octets are upper case, unreserved characters are
+// decoded and the dot segments are removed from the path. At the
+// scheme_based level, a default port is left out too. Where normalize
+// would throw because a ".." segment has nothing to remove, the segment
+// is ignored.
+class uri_normalizer {
+ public:
+  uri_normalizer(string_view uri, const compact_uri_parts &parts,
+                 uri_comparison_level level) noexcept;
+
+  // Sets piece to the next piece of the normalized URI, which is valid
+  // until the next call, or returns false at the end of the URI.
+  bool next(string_view &piece) noexcept;
+
+  // Returns true if the path has a ".." segment with nothing to remove,
+  // which normalize would have thrown for.
+  bool has_unmatched_dot_dot() const noexcept { return has_unmatched_; }
+
+ private:
+  enum class state {
+    text,
+    host,
+    path_segment,
+    path_end,
+    end,
+  };
+
+  // The URI is read as a list of regions: text that is copied with its
+  // percent encoded octets normalized, text that is lower case as well,
+  // an IP literal that is replaced by its canonical form, and the path,
+  // which is taken apart if it would be changed.
+  enum class region_kind {
+    text,
+    lower_case,
+    host,
+    path,
+  };
+
+  struct region {
+    std::size_t first, last;
+    region_kind kind;
+  };
+
+  void add_region(std::size_t first, std::size_t last,
+                  region_kind kind) noexcept;
+  void next_region() noexcept;
+  void start(state s, std::size_t first, std::size_t last) noexcept;
+  void next_segment() noexcept;
+  bool is_kept(std::size_t last) const noexcept;
+  bool read(string_view &piece) noexcept;
+  std::size_t segment_last(std::size_t first) const noexcept;
+
+  const char *uri_;
+  std::size_t size_;
+  std::size_t path_first_, path_last_;
+  bool is_normal_, has_dot_dot_, has_unmatched_, has_segment_, separator_;
+  bool lower_case_;
+  state state_;
+  std::size_t it_, last_, segment_;
+  char buffer_[8];
+  char host_[max_ip_literal_size];
+  std::size_t host_size_;
+
+  static const std::size_t max_regions = 7;
+  region regions_[max_regions];
+  std::size_t region_count_, region_next_;
+
+  // When the path has a ".." segment, the segments that are kept are
+  // found in one pass, unless there are too many of them.
+  static const std::size_t max_kept = 32;
+  std::size_t kept_[max_kept];
+  std::size_t kept_count_, kept_next_;
+  bool has_kept_;
+};
+
+// Writes the URI normalized at the given level to normalized, and the
+// offsets of its parts to normalized_parts, so that it doesn't have to
+// be parsed again. Returns false if the path has a ".." segment with
+// nothing to remove.
+bool normalize_uri(string_view uri, const compact_uri_parts &parts,
+                   uri_comparison_level level, std::string &normalized,
+                   compact_uri_parts &normalized_parts);
+
+// Normalizes the URI at the given level in its own buffer, and updates
+// the offsets of its parts. The URI only allocates if a slash has to be
+// added at the start of the path and there's no room for it. Returns
+// false, and leaves the URI as it was, if the path has a ".." segment
+// with nothing to remove.
+bool normalize_uri_in_place(std::string &uri, compact_uri_parts &parts,
+                            uri_comparison_level level);
 }  // namespace detail
 }  // namespace network
 
@@ -4,9 +4,11 @@
 // http://www.boost.org/LICENSE_1_0.txt)
 
 #include "uri_parse.hpp"
+#include <cstring>
 #include <iterator>
 #include <limits>
-#include "grammar.hpp"
+#include <network/uri/detail/grammar.hpp>
+#include "uri_scan.hpp"
 #include <network/uri/detail/uri_parts.hpp>
 
 namespace network {
@@ -31,7 +33,7 @@ bool validate_scheme(string_view::const_iterator &it,
   }
 
   // The first character must be a letter
-  if (!std::isalpha(*it, std::locale("C"))) {
+  if (!is_char_class(*it, alpha_char)) {
     return false;
   }
   ++it;
@@ -39,19 +41,27 @@ bool validate_scheme(string_view::const_iterator &it,
   while (it != last) {
     if (*it == ':') {
       break;
-    } else if (!isalnum(it, last) && !is_in(it, last, "+-.")) {
+    } else if (!consume_if(it, last, scheme_char)) {
       return false;
     }
   }
 
-  return true;
+  // there must be a ':' after the scheme
+  return it != last;
+}
+
+// Says why a character isn't valid in a part of the URI, which is
+// either a bad pct-encoded triplet or a bad character in that part.
+uri_error char_error(string_view::const_iterator it,
+                     string_view::const_iterator last, uri_error error) {
+  return ((it != last) && (*it == '%')) ? uri_error::invalid_pct_encoded
+                                        : error;
 }
 
-bool validate_user_info(string_view::const_iterator it,
+bool validate_user_info(string_view::const_iterator &it,
                         string_view::const_iterator last) {
   while (it != last) {
-    if (!is_unreserved(it, last) && !is_pct_encoded(it, last) &&
-        !is_sub_delim(it, last) && !is_in(it, last, ":")) {
+    if (!is_user_info_char(it, last)) {
       return false;
     }
   }
@@ -68,7 +78,7 @@ bool set_host_and_port(string_view::const_iterator first,
     auto port_start = last_colon;
     ++port_start;
     parts.hier_part.host = uri_part(first, last_colon);
-    if (!is_valid_port(port_start)) {
+    if (!is_valid_port(port_start, last)) {
       return false;
     }
     parts.hier_part.port = uri_part(port_start, last);
@@ -79,21 +89,170 @@ bool set_host_and_port(string_view::const_iterator first,
 bool validate_fragment(string_view::const_iterator &it,
                        string_view::const_iterator last) {
   while (it != last) {
-    if (!is_pchar(it, last) && !is_in(it, last, "?/")) {
+    it = scan_query(it, last);
+    if (it == last) {
+      break;
+    }
+
+    if (!is_query_char(it, last)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The schemes of nearly every URI that is seen on the web, with the
+// "://" that follows them. The table is a constant, so it can be used
+// by a uri that is constructed during static initialization.
+struct web_scheme {
+  const char *prefix;
+  std::ptrdiff_t length;
+};
+
+constexpr web_scheme web_schemes[] = {
+    {"https://", 5}, {"http://", 4}, {"wss://", 3}, {"ws://", 2},
+};
+
+// Returns the length of the scheme if the URI starts with one of the
+// web schemes followed by "://", and 0 otherwise.
+std::ptrdiff_t web_scheme_length(string_view::const_iterator first,
+                                 string_view::const_iterator last) {
+  for (const auto &scheme : web_schemes) {
+    const auto size = scheme.length + 3;
+    if ((last - first >= size) &&
+        (std::memcmp(first, scheme.prefix, static_cast<std::size_t>(size)) ==
+         0)) {
+      return scheme.length;
+    }
+  }
+  return 0;
+}
+
+bool is_authority_delimiter(string_view::const_iterator it,
+                            string_view::const_iterator last) {
+  return (it == last) || (*it == '/') || (*it == '?') || (*it == '#');
+}
+
+// Parses the scheme and authority of a URI with a web scheme and a
+// plain authority: a reg-name host, and an optional port of up to
+// five digits. Anything else is left to the generic parser, so this
+// doesn't change the parts of the URI or move the iterator unless it
+// succeeds.
+bool parse_web_authority(string_view::const_iterator &it,
+                         string_view::const_iterator last, uri_parts &parts) {
+  const auto scheme_length = web_scheme_length(it, last);
+  if (scheme_length == 0) {
+    return false;
+  }
+
+  const auto host_first = it + scheme_length + 3;
+  const auto host_last =
+      scan_short<unreserved_char | sub_delim_char>(host_first, last);
+  if (host_first == host_last) {
+    return false;
+  }
+
+  auto authority_last = host_last;
+  if ((host_last != last) && (*host_last == ':')) {
+    ++authority_last;
+    unsigned long port = 0;
+    while ((authority_last != last) && (authority_last - host_last <= 5) &&
+           is_char_class(*authority_last, digit_char)) {
+      port = (port * 10) + static_cast<unsigned long>(*authority_last - '0');
+      ++authority_last;
+    }
+
+    if (port >= std::numeric_limits<unsigned short>::max()) {
+      return false;
+    }
+  }
+
+  if (!is_authority_delimiter(authority_last, last)) {
+    return false;
+  }
+
+  parts.scheme = uri_part(it, it + scheme_length);
+  parts.hier_part.host = uri_part(host_first, host_last);
+  if (host_last != authority_last) {
+    parts.hier_part.port = uri_part(host_last + 1, authority_last);
+  }
+  it = authority_last;
+  return true;
+}
+
+// Parses the path, query and fragment that follow the authority, in
+// the same way as the generic parser.
+bool parse_path_query_fragment(string_view::const_iterator &it,
+                               string_view::const_iterator last,
+                               uri_parts &parts, uri_error &error) {
+  auto first = it;
+  while (it != last) {
+    it = scan_path(it, last);
+    if ((it == last) || (*it == '?') || (*it == '#')) {
+      break;
+    }
+
+    if (!is_path_char(it, last)) {
+      error = char_error(it, last, uri_error::invalid_path);
       return false;
     }
   }
+  parts.hier_part.path = uri_part(first, it);
+
+  if ((it != last) && (*it == '?')) {
+    ++it;
+    first = it;
+    while (it != last) {
+      it = scan_query(it, last);
+      if ((it == last) || (*it == '#')) {
+        break;
+      }
+
+      if (!is_query_char(it, last)) {
+        error = char_error(it, last, uri_error::invalid_query);
+        return false;
+      }
+    }
+    parts.query = uri_part(first, it);
+  }
+
+  if (it != last) {
+    // move past the fragment delimiter
+    ++it;
+    first = it;
+    if (!validate_fragment(it, last)) {
+      error = char_error(it, last, uri_error::invalid_fragment);
+      return false;
+    }
+    parts.fragment = uri_part(first, last);
+  }
   return true;
 }
 }  // namespace
 
 bool parse(string_view::const_iterator &it, string_view::const_iterator last,
            uri_parts &parts) {
+  uri_error error;
+  return parse(it, last, parts, error);
+}
+
+bool parse(string_view::const_iterator &it, string_view::const_iterator last,
+           uri_parts &parts, uri_error &error) {
+  if (parse_web_authority(it, last, parts)) {
+    return parse_path_query_fragment(it, last, parts, error);
+  }
+  return parse_generic(it, last, parts, error);
+}
+
+bool parse_generic(string_view::const_iterator &it,
+                   string_view::const_iterator last, uri_parts &parts,
+                   uri_error &error) {
   auto state = uri_state::scheme;
 
   auto first = it;
 
   if (it == last) {
+    error = uri_error::empty_uri;
     return false;
   }
 
@@ -103,9 +262,18 @@ bool parse(string_view::const_iterator &it, string_view::const_iterator last,
     ++it;
     state = uri_state::hier_part;
   } else {
+    error = uri_error::invalid_scheme;
     return false;
   }
 
+  // the port starts after the last colon in the authority
+  auto invalid_port = [&it, &error](string_view::const_iterator last_colon) {
+    it = last_colon;
+    ++it;
+    error = uri_error::invalid_port;
+    return false;
+  };
+
   // Hierarchical part
   auto hp_state = hier_part_state::first_slash;
   // this is used by the user_info/port
@@ -133,7 +301,10 @@ bool parse(string_view::const_iterator &it, string_view::const_iterator last,
         hp_state = hier_part_state::path;
       }
     } else if (hp_state == hier_part_state::authority) {
-      if (is_in(first, last, "@:")) {
+      if ((*first == '@') || (*first == ':')) {
+        error = (*first == '@') ? uri_error::invalid_user_info
+                                : uri_error::invalid_host;
+        it = first;
         return false;
       }
 
@@ -143,7 +314,10 @@ bool parse(string_view::const_iterator &it, string_view::const_iterator last,
       }
 
       if (*it == '@') {
-        if (!validate_user_info(first, it)) {
+        auto user_info_it = first;
+        if (!validate_user_info(user_info_it, it)) {
+          error = char_error(user_info_it, it, uri_error::invalid_user_info);
+          it = user_info_it;
           return false;
         }
         parts.hier_part.user_info = uri_part(first, it);
@@ -167,7 +341,7 @@ bool parse(string_view::const_iterator &it, string_view::const_iterator last,
       } else if (*it == '/') {
         // we skipped right past the host and port, and are at the path.
         if (!set_host_and_port(first, it, last_colon, parts)) {
-          return false;
+          return invalid_port(last_colon);
         }
         hp_state = hier_part_state::path;
         first = it;
@@ -175,7 +349,7 @@ bool parse(string_view::const_iterator &it, string_view::const_iterator last,
       } else if (*it == '?') {
         // the path is empty, but valid, and the next part is the query
         if (!set_host_and_port(first, it, last_colon, parts)) {
-          return false;
+          return invalid_port(last_colon);
         }
         parts.hier_part.path = uri_part(it, it);
         state = uri_state::query;
@@ -185,7 +359,7 @@ bool parse(string_view::const_iterator &it, string_view::const_iterator last,
       } else if (*it == '#') {
         // the path is empty, but valid, and the next part is the fragment
         if (!set_host_and_port(first, it, last_colon, parts)) {
-          return false;
+          return invalid_port(last_colon);
         }
         parts.hier_part.path = uri_part(it, it);
         state = uri_state::fragment;
@@ -195,6 +369,8 @@ bool parse(string_view::const_iterator &it, string_view::const_iterator last,
       }
     } else if (hp_state == hier_part_state::host) {
       if (*first == ':') {
+        error = uri_error::invalid_host;
+        it = first;
         return false;
       }
 
@@ -228,6 +404,8 @@ bool parse(string_view::const_iterator &it, string_view::const_iterator last,
       }
     } else if (hp_state == hier_part_state::host_ipv6) {
       if (*first != '[') {
+        error = uri_error::invalid_host;
+        it = first;
         return false;
       }
 
@@ -265,7 +443,9 @@ bool parse(string_view::const_iterator &it, string_view::const_iterator last,
     } else if (hp_state == hier_part_state::port) {
       if (*first == '/') {
         // the port is empty, but valid
-        if (!is_valid_port(first)) {
+        if (!is_valid_port(first, it)) {
+          error = uri_error::invalid_port;
+          it = first;
           return false;
         }
         parts.hier_part.port = uri_part(first, it);
@@ -276,7 +456,9 @@ bool parse(string_view::const_iterator &it, string_view::const_iterator last,
       }
 
       if (*it == '/') {
-        if (!is_valid_port(first)) {
+        if (!is_valid_port(first, it)) {
+          error = uri_error::invalid_port;
+          it = first;
           return false;
         }
         parts.hier_part.port = uri_part(first, it);
@@ -284,10 +466,17 @@ bool parse(string_view::const_iterator &it, string_view::const_iterator last,
         first = it;
         continue;
       } else if (!isdigit(it, last)) {
+        error = uri_error::invalid_port;
         return false;
       }
       continue;
     } else if (hp_state == hier_part_state::path) {
+      // skip over the characters that need no further checks
+      it = scan_path(it, last);
+      if (it == last) {
+        continue;
+      }
+
       if (*it == '?') {
         parts.hier_part.path = uri_part(first, it);
         // move past the query delimiter
@@ -304,7 +493,8 @@ bool parse(string_view::const_iterator &it, string_view::const_iterator last,
         break;
       }
 
-      if (!is_pchar(it, last) && !is_in(it, last, "/")) {
+      if (!is_path_char(it, last)) {
+        error = char_error(it, last, uri_error::invalid_path);
         return false;
       } else {
         continue;
@@ -316,7 +506,12 @@ bool parse(string_view::const_iterator &it, string_view::const_iterator last,
 
   if (state == uri_state::query) {
     while (it != last) {
-      if (!is_pchar(it, last) && !is_in(it, last, "?/")) {
+      it = scan_query(it, last);
+      if (it == last) {
+        break;
+      }
+
+      if (!is_query_char(it, last)) {
         // If this is a fragment, keep going
         if (*it == '#') {
           parts.query = uri_part(first, it);
@@ -326,6 +521,7 @@ bool parse(string_view::const_iterator &it, string_view::const_iterator last,
           state = uri_state::fragment;
           break;
         } else {
+          error = char_error(it, last, uri_error::invalid_query);
           return false;
         }
       }
@@ -334,6 +530,7 @@ bool parse(string_view::const_iterator &it, string_view::const_iterator last,
 
   if (state == uri_state::fragment) {
     if (!validate_fragment(it, last)) {
+      error = char_error(it, last, uri_error::invalid_fragment);
       return false;
     }
   }
@@ -342,29 +539,35 @@ bool parse(string_view::const_iterator &it, string_view::const_iterator last,
   if (state == uri_state::hier_part) {
     if (hp_state == hier_part_state::authority) {
       if (first == last) {
+        error = uri_error::invalid_host;
+        it = last;
         return false;
       }
 
       if (!set_host_and_port(first, last, last_colon, parts)) {
-        return false;
+        return invalid_port(last_colon);
       }
       parts.hier_part.path = uri_part(last, last);
     } else if (hp_state == hier_part_state::host) {
       if (first == last) {
+        error = uri_error::invalid_host;
+        it = last;
         return false;
       }
 
       if (!set_host_and_port(first, last, last_colon, parts)) {
-        return false;
+        return invalid_port(last_colon);
       }
       parts.hier_part.path = uri_part(last, last);
     } else if (hp_state == hier_part_state::host_ipv6) {
       if (!set_host_and_port(first, last, last_colon, parts)) {
-        return false;
+        return invalid_port(last_colon);
       }
       parts.hier_part.path = uri_part(last, last);
     } else if (hp_state == hier_part_state::port) {
-      if (!is_valid_port(first)) {
+      if (!is_valid_port(first, last)) {
+        error = uri_error::invalid_port;
+        it = first;
         return false;
       }
       parts.hier_part.port = uri_part(first, last);
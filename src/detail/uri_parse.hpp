@@ -7,6 +7,7 @@
 #define NETWORK_DETAIL_URI_PARSE_INC
 
 #include <network/string_view.hpp>
+#include <network/uri/uri_errors.hpp>
 
 namespace network {
 namespace detail {
@@ -14,6 +15,16 @@ struct uri_parts;
 
 bool parse(string_view::const_iterator &first, string_view::const_iterator last,
            uri_parts &parts);
+
+// On failure, first is left where parsing stopped and error says why.
+bool parse(string_view::const_iterator &first, string_view::const_iterator last,
+           uri_parts &parts, uri_error &error);
+
+// The same as parse, but without the fast path for http, https, ws and
+// wss URIs.
+bool parse_generic(string_view::const_iterator &first,
+                   string_view::const_iterator last, uri_parts &parts,
+                   uri_error &error);
 }  // namespace detail
 }  // namespace network
 
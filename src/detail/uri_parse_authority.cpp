@@ -7,7 +7,7 @@
 #include <cstdlib>
 #include <iterator>
 #include <limits>
-#include "grammar.hpp"
+#include <network/uri/detail/grammar.hpp>
 
 namespace network {
 namespace detail {
@@ -24,7 +24,7 @@ bool parse_authority(string_view::const_iterator &it,
   auto state = authority_state::user_info;
   while (it != last) {
     if (state == authority_state::user_info) {
-      if (is_in(first, last, "@:")) {
+      if ((*first == '@') || (*first == ':')) {
         return false;
       }
 
@@ -82,7 +82,7 @@ bool parse_authority(string_view::const_iterator &it,
       if (*first == '/') {
         // the port is empty, but valid
         port = uri_part(first, it);
-        if (!is_valid_port(std::begin(*port))) {
+        if (!is_valid_port(std::begin(*port), std::end(*port))) {
           return false;
         }
 
@@ -105,7 +105,7 @@ bool parse_authority(string_view::const_iterator &it,
     host = uri_part(first, last);
   } else if (state == authority_state::port) {
     port = uri_part(first, last);
-    if (!is_valid_port(std::begin(*port))) {
+    if (!is_valid_port(std::begin(*port), std::end(*port))) {
       return false;
     }
   }
@@ -8,9 +8,9 @@
 
 #include <string>
 #include <vector>
-#include <locale>
 #include <network/optional.hpp>
 #include <network/uri/detail/decode.hpp>
+#include <network/uri/detail/grammar.hpp>
 
 namespace network {
 namespace detail {
@@ -33,7 +33,7 @@ struct percent_encoded_to_upper {
     if (c == '%') {
       count = 2;
     } else if (count > 0) {
-      c = std::toupper(c, std::locale());
+      c = to_upper_char(c);
       --count;
     }
   }
@@ -43,23 +43,12 @@ struct percent_encoded_to_upper {
 
 template <class Iter>
 Iter decode_encoded_unreserved_chars(Iter first, Iter last) {
-  // unreserved  = ALPHA / DIGIT / "-" / "." / "_" / "~"
-  // clang-format off
-  const auto is_unreserved = [](char c) {
-      return std::isalnum(c, std::locale())
-      || '-' == c
-      || '.' == c
-      || '_' == c
-      || '~' == c;
-  };
-  // clang-format on
-
   auto it = first, it2 = first;
   while (it != last) {
     if (*it == '%') {
       const auto sfirst = it;
       const auto opt_char = percent_encode(sfirst);
-      if (opt_char && is_unreserved(*opt_char)) {
+      if (opt_char && is_unreserved_char(*opt_char)) {
         *it2 = *opt_char;
         ++it;
         ++it;
@@ -0,0 +1,163 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "uri_scan.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define NETWORK_URI_SCAN_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif  // defined(_MSC_VER)
+#endif
+
+// AVX2 is only used when the CPU supports it, which is checked at
+// run time.
+#if defined(NETWORK_URI_SCAN_SSE2) && defined(__linux__) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define NETWORK_URI_SCAN_AVX2
+#include <immintrin.h>
+#endif
+
+namespace network {
+namespace detail {
+namespace {
+typedef string_view::const_iterator const_iterator;
+
+#if defined(NETWORK_URI_SCAN_SSE2)
+inline unsigned count_trailing_zeros(unsigned mask) {
+#if defined(_MSC_VER)
+  unsigned long index = 0;
+  _BitScanForward(&index, mask);
+  return static_cast<unsigned>(index);
+#else
+  return static_cast<unsigned>(__builtin_ctz(mask));
+#endif  // defined(_MSC_VER)
+}
+
+inline __m128i in_range_sse2(__m128i v, char first, char last) {
+  // All the bounds are printable ASCII, so the signed comparison
+  // also rejects every byte >= 0x80.
+  return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(first - 1)),
+                       _mm_cmpgt_epi8(_mm_set1_epi8(last + 1), v));
+}
+
+inline __m128i is_sse2(__m128i v, char c) {
+  return _mm_cmpeq_epi8(v, _mm_set1_epi8(c));
+}
+
+// Returns a bit mask of the bytes in the block that are not in the
+// path (or query) character class.
+template <bool Query>
+inline unsigned invalid_mask_sse2(__m128i v) {
+  // pchar = ALPHA / DIGIT / "-" / "." / "_" / "~" / "!" / "$" / "&" /
+  //         "'" / "(" / ")" / "*" / "+" / "," / ";" / "=" / ":" / "@"
+  __m128i valid = _mm_or_si128(in_range_sse2(v, '&', ';'),   // &'()*+,-./0-9:;
+                               in_range_sse2(v, '@', 'Z'));   // @A-Z
+  valid = _mm_or_si128(valid, in_range_sse2(v, 'a', 'z'));
+  valid = _mm_or_si128(valid, _mm_or_si128(is_sse2(v, '!'), is_sse2(v, '$')));
+  valid = _mm_or_si128(valid, _mm_or_si128(is_sse2(v, '='), is_sse2(v, '_')));
+  valid = _mm_or_si128(valid, is_sse2(v, '~'));
+  if (Query) {
+    valid = _mm_or_si128(valid, is_sse2(v, '?'));
+  }
+  return ~static_cast<unsigned>(_mm_movemask_epi8(valid)) & 0xffffu;
+}
+
+template <bool Query>
+const_iterator scan_sse2(const_iterator first, const_iterator last) {
+  while (last - first >= 16) {
+    const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+    const auto mask = invalid_mask_sse2<Query>(v);
+    if (mask != 0) {
+      return first + count_trailing_zeros(mask);
+    }
+    first += 16;
+  }
+  return first;
+}
+#endif  // defined(NETWORK_URI_SCAN_SSE2)
+
+#if defined(NETWORK_URI_SCAN_AVX2)
+#define NETWORK_URI_TARGET_AVX2 __attribute__((target("avx2")))
+
+NETWORK_URI_TARGET_AVX2
+inline __m256i in_range_avx2(__m256i v, char first, char last) {
+  return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(first - 1)),
+                          _mm256_cmpgt_epi8(_mm256_set1_epi8(last + 1), v));
+}
+
+NETWORK_URI_TARGET_AVX2
+inline __m256i is_avx2(__m256i v, char c) {
+  return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c));
+}
+
+template <bool Query>
+NETWORK_URI_TARGET_AVX2 inline unsigned invalid_mask_avx2(__m256i v) {
+  __m256i valid =
+      _mm256_or_si256(in_range_avx2(v, '&', ';'), in_range_avx2(v, '@', 'Z'));
+  valid = _mm256_or_si256(valid, in_range_avx2(v, 'a', 'z'));
+  valid = _mm256_or_si256(valid,
+                          _mm256_or_si256(is_avx2(v, '!'), is_avx2(v, '$')));
+  valid = _mm256_or_si256(valid,
+                          _mm256_or_si256(is_avx2(v, '='), is_avx2(v, '_')));
+  valid = _mm256_or_si256(valid, is_avx2(v, '~'));
+  if (Query) {
+    valid = _mm256_or_si256(valid, is_avx2(v, '?'));
+  }
+  return ~static_cast<unsigned>(_mm256_movemask_epi8(valid));
+}
+
+template <bool Query>
+NETWORK_URI_TARGET_AVX2 const_iterator scan_avx2(const_iterator first,
+                                                 const_iterator last) {
+  while (last - first >= 32) {
+    const auto v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+    const auto mask = invalid_mask_avx2<Query>(v);
+    if (mask != 0) {
+      return first + count_trailing_zeros(mask);
+    }
+    first += 32;
+  }
+  return first;
+}
+
+bool has_avx2() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") != 0;
+}
+#endif  // defined(NETWORK_URI_SCAN_AVX2)
+
+// Each stage either stops at the first character that is not in the
+// class, or leaves a tail that is too short for it, which is then
+// handed on to the next, narrower, stage.
+template <bool Query>
+const_iterator scan(const_iterator first, const_iterator last) {
+#if defined(NETWORK_URI_SCAN_AVX2)
+  static const bool use_avx2 = has_avx2();
+  if (use_avx2) {
+    first = scan_avx2<Query>(first, last);
+  }
+#endif  // defined(NETWORK_URI_SCAN_AVX2)
+
+#if defined(NETWORK_URI_SCAN_SSE2)
+  first = scan_sse2<Query>(first, last);
+#endif  // defined(NETWORK_URI_SCAN_SSE2)
+
+  return scan_short<Query ? query_char : path_char>(first, last);
+}
+}  // namespace
+
+const_iterator scan_path_block(const_iterator first, const_iterator last) {
+  return scan<false>(first, last);
+}
+
+const_iterator scan_query_block(const_iterator first, const_iterator last) {
+  return scan<true>(first, last);
+}
+}  // namespace detail
+}  // namespace network
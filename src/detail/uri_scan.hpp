@@ -0,0 +1,59 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NETWORK_DETAIL_URI_SCAN_INC
+#define NETWORK_DETAIL_URI_SCAN_INC
+
+#include <cstddef>
+#include <network/string_view.hpp>
+#include <network/uri/detail/grammar.hpp>
+
+namespace network {
+namespace detail {
+// These skip over a run of characters that the parser's state
+// machine would accept without doing anything, and return an
+// iterator to the first character that needs the state machine's
+// attention: a delimiter, a percent-encoded triplet or an invalid
+// character. Long runs are checked a block at a time using SIMD
+// instructions where they are available.
+
+// The smallest block that is checked in one go.
+const std::ptrdiff_t scan_block_size = 16;
+
+string_view::const_iterator scan_path_block(string_view::const_iterator first,
+                                            string_view::const_iterator last);
+
+string_view::const_iterator scan_query_block(string_view::const_iterator first,
+                                             string_view::const_iterator last);
+
+// Runs that are shorter than a block are the common case, so they
+// are checked here without a function call.
+template <unsigned short Classes>
+inline string_view::const_iterator scan_short(
+    string_view::const_iterator first, string_view::const_iterator last) {
+  while ((first != last) && is_char_class(*first, Classes)) {
+    ++first;
+  }
+  return first;
+}
+
+// Skips over pchar (without pct-encoded) and '/'.
+inline string_view::const_iterator scan_path(
+    string_view::const_iterator first, string_view::const_iterator last) {
+  return (last - first < scan_block_size) ? scan_short<path_char>(first, last)
+                                          : scan_path_block(first, last);
+}
+
+// Skips over pchar (without pct-encoded), '/' and '?'. This is used
+// for both the query and the fragment.
+inline string_view::const_iterator scan_query(
+    string_view::const_iterator first, string_view::const_iterator last) {
+  return (last - first < scan_block_size) ? scan_short<query_char>(first, last)
+                                          : scan_query_block(first, last);
+}
+}  // namespace detail
+}  // namespace network
+
+#endif  // NETWORK_DETAIL_URI_SCAN_INC
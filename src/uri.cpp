@@ -5,52 +5,20 @@
 // http://www.boost.org/LICENSE_1_0.txt)
 
 #include <cassert>
-#include <locale>
+#include <limits>
 #include <algorithm>
 #include <functional>
+#include <utility>
 #include "network/uri/uri.hpp"
+#include "network/uri/uri_view.hpp"
+#include "network/uri/detail/uri_assemble.hpp"
 #include "detail/uri_parse.hpp"
-#include "detail/uri_advance_parts.hpp"
-#include "detail/uri_percent_encode.hpp"
 #include "detail/uri_normalize.hpp"
 #include "detail/uri_resolve.hpp"
 #include "detail/algorithm.hpp"
 
 namespace network {
 namespace {
-// With the parser, we use string_views, which are mutable. However,
-// there are times (e.g. during normalization), when we want a part
-// to be mutable. This function returns a pair of
-// std::string::iterators in the same range as the URI part.
-//
-inline std::pair<std::string::iterator, std::string::iterator> mutable_part(
-    std::string &str, detail::uri_part part) {
-  auto view = string_view(str);
-
-  auto first_index = std::distance(std::begin(view), std::begin(part));
-  auto first = std::begin(str);
-  std::advance(first, first_index);
-
-  auto last_index = std::distance(std::begin(view), std::end(part));
-  auto last = std::begin(str);
-  std::advance(last, last_index);
-
-  return std::make_pair(first, last);
-}
-
-// This is a convenience function that converts a part of a
-// std::string to a string_view.
-inline string_view to_string_view(const std::string &uri,
-                                  detail::uri_part part) {
-  if (!part.empty()) {
-    const char *c_str = uri.c_str();
-    const char *part_begin = &(*(std::begin(part)));
-    std::advance(c_str, std::distance(c_str, part_begin));
-    return string_view(c_str, std::distance(std::begin(part), std::end(part)));
-  }
-  return string_view();
-}
-
 inline optional<std::string> make_arg(optional<string_view> view) {
   if (view) {
     return view->to_string();
@@ -58,8 +26,7 @@ inline optional<std::string> make_arg(optional<string_view> view) {
   return nullopt;
 }
 
-template <class T>
-inline void ignore(T) {}
+typedef detail::compact_uri_parts::offset_type offset_type;
 }  // namespace
 
 void uri::initialize(optional<string_type> scheme,
@@ -67,121 +34,38 @@ void uri::initialize(optional<string_type> scheme,
                      optional<string_type> host, optional<string_type> port,
                      optional<string_type> path, optional<string_type> query,
                      optional<string_type> fragment) {
-  if (scheme) {
-    uri_.append(*scheme);
-  }
-
-  if (user_info || host || port) {
-    if (scheme) {
-      uri_.append("://");
-    }
-
-    if (user_info) {
-      uri_.append(*user_info);
-      uri_.append("@");
-    }
-
-    if (host) {
-      uri_.append(*host);
-    } else {
-      throw uri_builder_error();
-    }
-
-    if (port) {
-      uri_.append(":");
-      uri_.append(*port);
-    }
-  } else {
-    if (scheme) {
-      if (path || query || fragment) {
-        uri_.append(":");
-      } else {
-        throw uri_builder_error();
-      }
-    }
-  }
-
-  if (path) {
-    // if the URI is not opaque and the path is not already prefixed
-    // with a '/', add one.
-    if (host && (!path->empty() && path->front() != '/')) {
-      path = "/" + *path;
-    }
-    uri_.append(*path);
-  }
-
-  if (query) {
-    uri_.append("?");
-    uri_.append(*query);
-  }
-
-  if (fragment) {
-    uri_.append("#");
-    uri_.append(*fragment);
-  }
-
-  uri_view_ = string_view(uri_);
-
-  auto it = std::begin(uri_view_);
-  if (scheme) {
-    uri_parts_.scheme = detail::copy_part(*scheme, it);
-    // ignore : and ://
-    if (*it == ':') {
-      ++it;
-    }
-    if (*it == '/' && *(it + 1) == '/') {
-      it += 2;
-    }
-  }
-
-  if (user_info) {
-    uri_parts_.hier_part.user_info = detail::copy_part(*user_info, it);
-    ++it;  // ignore @
-  }
-
-  if (host) {
-    uri_parts_.hier_part.host = detail::copy_part(*host, it);
-  }
+  detail::assemble_uri(uri_, uri_parts_, scheme, user_info, host, port, path,
+                       query, fragment);
+}
 
-  if (port) {
-    ++it;  // ignore :
-    uri_parts_.hier_part.port = detail::copy_part(*port, it);
-  }
+uri::uri() {}
 
-  if (path) {
-    uri_parts_.hier_part.path = detail::copy_part(*path, it);
-  }
+uri::uri(const uri &other) : uri_(other.uri_), uri_parts_(other.uri_parts_) {}
 
-  if (query) {
-    ++it;  // ignore ?
-    uri_parts_.query = detail::copy_part(*query, it);
-  }
+uri::uri(const uri_builder &builder) {
+  initialize(builder.scheme_, builder.user_info_, builder.host_, builder.port_,
+             builder.path_, builder.query_, builder.fragment_);
+}
 
-  if (fragment) {
-    ++it;  // ignore #
-    uri_parts_.fragment = detail::copy_part(*fragment, it);
+uri::uri(string_type &&source) {
+  if (!initialize(std::move(source))) {
+    throw uri_syntax_error();
   }
 }
 
-uri::uri() : uri_view_(uri_) {}
-
-uri::uri(const uri &other) : uri_(other.uri_), uri_view_(uri_) {
-  detail::advance_parts(uri_view_, uri_parts_, other.uri_parts_);
+uri::uri(string_type &&source, std::error_code &ec) {
+  if (!initialize(std::move(source))) {
+    ec = make_error_code(uri_error::invalid_syntax);
+  }
 }
 
-uri::uri(const uri_builder &builder) {
-  initialize(builder.scheme_, builder.user_info_, builder.host_, builder.port_,
-             builder.path_, builder.query_, builder.fragment_);
-}
+uri::uri(const uri_view &view)
+    : uri_(view.string()), uri_parts_(view.uri_parts_) {}
 
-uri::uri(uri &&other) noexcept
-    : uri_(std::move(other.uri_)),
-      uri_view_(uri_),
-      uri_parts_(std::move(other.uri_parts_)) {
-  detail::advance_parts(uri_view_, uri_parts_, other.uri_parts_);
+uri::uri(uri &&other) noexcept : uri_(std::move(other.uri_)),
+                                 uri_parts_(other.uri_parts_) {
   other.uri_.clear();
-  other.uri_view_ = string_view(other.uri_);
-  other.uri_parts_ = detail::uri_parts();
+  other.uri_parts_.clear();
 }
 
 uri::~uri() {}
@@ -193,71 +77,59 @@ uri &uri::operator=(uri other) {
 
 void uri::swap(uri &other) noexcept {
   uri_.swap(other.uri_);
-  uri_view_ = uri_;
-  other.uri_view_ = other.uri_;
-
-  const auto this_parts = uri_parts_;
-  uri_parts_.clear();
-  detail::advance_parts(uri_view_, uri_parts_, other.uri_parts_);
-  other.uri_parts_.clear();
-  detail::advance_parts(other.uri_view_, other.uri_parts_, this_parts);
+  std::swap(uri_parts_, other.uri_parts_);
 }
 
-uri::const_iterator uri::begin() const noexcept { return uri_view_.begin(); }
+uri::const_iterator uri::begin() const noexcept { return view().begin(); }
 
-uri::const_iterator uri::end() const noexcept { return uri_view_.end(); }
+uri::const_iterator uri::end() const noexcept { return view().end(); }
 
 bool uri::has_scheme() const noexcept {
-  return static_cast<bool>(uri_parts_.scheme);
+  return uri_parts_.has(detail::uri_component::scheme);
 }
 
 uri::string_view uri::scheme() const noexcept {
-  return has_scheme() ? to_string_view(uri_, *uri_parts_.scheme)
-                      : string_view{};
+  return uri_parts_.get(uri_.data(), detail::uri_component::scheme);
 }
 
 bool uri::has_user_info() const noexcept {
-  return static_cast<bool>(uri_parts_.hier_part.user_info);
+  return uri_parts_.has(detail::uri_component::user_info);
 }
 
 uri::string_view uri::user_info() const noexcept {
-  return has_user_info() ? to_string_view(uri_, *uri_parts_.hier_part.user_info)
-                         : string_view{};
+  return uri_parts_.get(uri_.data(), detail::uri_component::user_info);
 }
 
 bool uri::has_host() const noexcept {
-  return static_cast<bool>(uri_parts_.hier_part.host);
+  return uri_parts_.has(detail::uri_component::host);
 }
 
 uri::string_view uri::host() const noexcept {
-  return has_host() ? to_string_view(uri_, *uri_parts_.hier_part.host)
-                    : string_view{};
+  return uri_parts_.get(uri_.data(), detail::uri_component::host);
 }
 
 bool uri::has_port() const noexcept {
-  return static_cast<bool>(uri_parts_.hier_part.port);
+  return uri_parts_.has(detail::uri_component::port);
 }
 
 uri::string_view uri::port() const noexcept {
-  return has_port() ? to_string_view(uri_, *uri_parts_.hier_part.port)
-                    : string_view{};
+  return uri_parts_.get(uri_.data(), detail::uri_component::port);
 }
 
 bool uri::has_path() const noexcept {
-  return static_cast<bool>(uri_parts_.hier_part.path);
+  return uri_parts_.has(detail::uri_component::path);
 }
 
 uri::string_view uri::path() const noexcept {
-  return has_path() ? to_string_view(uri_, *uri_parts_.hier_part.path)
-                    : string_view{};
+  return uri_parts_.get(uri_.data(), detail::uri_component::path);
 }
 
 bool uri::has_query() const noexcept {
-  return static_cast<bool>(uri_parts_.query);
+  return uri_parts_.has(detail::uri_component::query);
 }
 
 uri::string_view uri::query() const noexcept {
-  return has_query() ? to_string_view(uri_, *uri_parts_.query) : string_view{};
+  return uri_parts_.get(uri_.data(), detail::uri_component::query);
 }
 
 uri::query_iterator::query_iterator() : query_{}, kvp_{} {}
@@ -361,8 +233,7 @@ void uri::query_iterator::increment() noexcept {
 }
 
 uri::query_iterator uri::query_begin() const noexcept {
-  return has_query() ? uri::query_iterator{uri_parts_.query}
-                     : uri::query_iterator{};
+  return uri_view(view(), uri_parts_).query_begin();
 }
 
 uri::query_iterator uri::query_end() const noexcept {
@@ -370,57 +241,17 @@ uri::query_iterator uri::query_end() const noexcept {
 }
 
 bool uri::has_fragment() const noexcept {
-  return static_cast<bool>(uri_parts_.fragment);
+  return uri_parts_.has(detail::uri_component::fragment);
 }
 
 uri::string_view uri::fragment() const noexcept {
-  return has_fragment() ? to_string_view(uri_, *uri_parts_.fragment)
-                        : string_view{};
+  return uri_parts_.get(uri_.data(), detail::uri_component::fragment);
 }
 
 bool uri::has_authority() const noexcept { return has_host(); }
 
 uri::string_view uri::authority() const noexcept {
-  if (!has_host()) {
-    return string_view{};
-  }
-
-  auto host = this->host();
-
-  auto user_info = string_view{};
-  if (has_user_info()) {
-    user_info = this->user_info();
-  }
-
-  auto port = string_view{};
-  if (has_port()) {
-    port = this->port();
-  }
-
-  auto first = std::begin(host), last = std::end(host);
-  if (has_user_info() && !user_info.empty()) {
-    first = std::begin(user_info);
-  } else if (host.empty() && has_port() && !port.empty()) {
-    first = std::begin(port);
-    --first;  // include ':' before port
-  }
-
-  if (host.empty()) {
-    if (has_port() && !port.empty()) {
-      last = std::end(port);
-    } else if (has_user_info() && !user_info.empty()) {
-      last = std::end(user_info);
-      ++last;  // include '@'
-    }
-  } else if (has_port()) {
-    if (port.empty()) {
-      ++last;  // include ':' after host
-    } else {
-      last = std::end(port);
-    }
-  }
-
-  return string_view(first, std::distance(first, last));
+  return uri_view(view(), uri_parts_).authority();
 }
 
 std::string uri::string() const { return uri_; }
@@ -437,7 +268,16 @@ std::u32string uri::u32string() const {
   return std::u32string(std::begin(*this), std::end(*this));
 }
 
-uri::string_view uri::view() const noexcept { return uri_view_; }
+uri::string_view uri::view() const noexcept { return string_view(uri_); }
+
+std::size_t uri::hash() const noexcept { return detail::hash_string(uri_); }
+
+std::size_t uri::hash(uri_comparison_level level) const noexcept {
+  if (uri_comparison_level::string_comparison == level) {
+    return hash();
+  }
+  return detail::hash_normalized(uri_, uri_parts_, level);
+}
 
 bool uri::empty() const noexcept { return uri_.empty(); }
 
@@ -447,82 +287,34 @@ bool uri::is_opaque() const noexcept {
   return (is_absolute() && !has_authority());
 }
 
-uri uri::normalize(uri_comparison_level level) const {
-  string_type normalized(uri_);
-  string_view normalized_view(normalized);
-  detail::uri_parts parts;
-  detail::advance_parts(normalized_view, parts, uri_parts_);
-
-  if (uri_comparison_level::syntax_based == level) {
-    // All alphabetic characters in the scheme and host are
-    // lower-case...
-    if (parts.scheme) {
-      std::string::iterator first, last;
-      std::tie(first, last) = mutable_part(normalized, *parts.scheme);
-      std::transform(first, last, first,
-                     [](char ch) { return std::tolower(ch, std::locale()); });
-    }
-
-    // if (parts.hier_part.host) {
-    //   std::string::iterator first, last;
-    //   std::tie(first, last) = mutable_part(normalized,
-    //   *parts.hier_part.host); std::transform(first, last, first,
-    //                  [](char ch) { return std::tolower(ch, std::locale());
-    //                  });
-    // }
-
-    // ...except when used in percent encoding
-    detail::for_each(normalized,
-                     detail::percent_encoded_to_upper<std::string>());
-
-    // parts are invalidated here
-    // there's got to be a better way of doing this that doesn't
-    // mean parsing again (twice!)
-    normalized.erase(detail::decode_encoded_unreserved_chars(
-                         std::begin(normalized), std::end(normalized)),
-                     std::end(normalized));
-    normalized_view = string_view(normalized);
-
-    // need to parse the parts again as the underlying string has changed
-    const_iterator it = std::begin(normalized_view),
-                   last = std::end(normalized_view);
-    bool is_valid = detail::parse(it, last, parts);
-    ignore(is_valid);
-    assert(is_valid);
-
-    if (parts.hier_part.path) {
-      uri::string_type path = detail::normalize_path_segments(
-          to_string_view(normalized, *parts.hier_part.path));
-
-      // put the normalized path back into the uri
-      optional<string_type> query, fragment;
-      if (parts.query) {
-        query = parts.query->to_string();
-      }
-
-      if (parts.fragment) {
-        fragment = parts.fragment->to_string();
-      }
+uri uri::normalize(uri_comparison_level level) const & {
+  if (uri_comparison_level::string_comparison == level) {
+    return *this;
+  }
 
-      auto path_begin = std::begin(normalized);
-      auto path_range = mutable_part(normalized, *parts.hier_part.path);
-      std::advance(path_begin, std::distance(path_begin, path_range.first));
-      normalized.erase(path_begin, std::end(normalized));
-      normalized.append(path);
+  // the normalized string and the offsets of its parts are written
+  // together, so it isn't parsed again
+  uri result;
+  if (!detail::normalize_uri(uri_, uri_parts_, level, result.uri_,
+                             result.uri_parts_)) {
+    throw uri_builder_error();
+  }
+  return result;
+}
 
-      if (query) {
-        normalized.append("?");
-        normalized.append(*query);
-      }
+uri uri::normalize(uri_comparison_level level) && {
+  normalize_in_place(level);
+  return std::move(*this);
+}
 
-      if (fragment) {
-        normalized.append("#");
-        normalized.append(*fragment);
-      }
-    }
+void uri::normalize_in_place(uri_comparison_level level) {
+  if (uri_comparison_level::string_comparison == level) {
+    return;
   }
 
-  return uri(normalized);
+  if (!detail::normalize_uri_in_place(uri_, uri_parts_, level)) {
+    throw uri_builder_error();
+  }
 }
 
 uri uri::make_relative(const uri &other) const {
@@ -664,15 +456,24 @@ int uri::compare(const uri &other, uri_comparison_level level) const noexcept {
     return 1;
   }
 
-  return normalize(level).uri_.compare(other.normalize(level).uri_);
+  return detail::compare_normalized(uri_, uri_parts_, other.uri_,
+                                    other.uri_parts_, level);
 }
 
-bool uri::initialize(const string_type &uri) {
-  uri_ = detail::trim_copy(uri);
+bool uri::initialize(string_type &&uri) {
+  uri_ = std::move(uri);
+  detail::trim_in_place(uri_);
   if (!uri_.empty()) {
-    uri_view_ = string_view(uri_);
-    const_iterator it = std::begin(uri_view_), last = std::end(uri_view_);
-    bool is_valid = detail::parse(it, last, uri_parts_);
+    // the parts are stored as 32-bit offsets
+    if (uri_.size() > std::numeric_limits<offset_type>::max()) {
+      return false;
+    }
+
+    auto view = string_view(uri_);
+    const_iterator it = std::begin(view), last = std::end(view);
+    detail::uri_parts parts;
+    bool is_valid = detail::parse(it, last, parts);
+    uri_parts_ = detail::compact_uri_parts(std::begin(view), parts);
     return is_valid;
   }
   return true;
@@ -0,0 +1,188 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include "network/uri/uri_batch.hpp"
+#include "detail/uri_parse.hpp"
+#include "detail/algorithm.hpp"
+
+namespace network {
+namespace {
+// Each thread parses a whole number of words in the validity bit map,
+// so that no two threads write to the same word.
+const std::size_t lines_per_word = 64;
+
+void find_lines(string_view buffer, std::vector<std::size_t> &offsets,
+                std::vector<uri_batch::offset_type> &lengths) {
+  const char *first = buffer.data(), *last = buffer.data() + buffer.size();
+  while (first != last) {
+    auto newline = static_cast<const char *>(
+        std::memchr(first, '\n', static_cast<std::size_t>(last - first)));
+    auto line_last = newline ? newline : last;
+    auto length = static_cast<std::size_t>(line_last - first);
+    offsets.push_back(static_cast<std::size_t>(first - buffer.data()));
+    // a line that is too long will be trimmed or rejected later
+    lengths.push_back(static_cast<uri_batch::offset_type>(
+        std::min<std::size_t>(length, uri_batch::npos)));
+    first = newline ? newline + 1 : last;
+  }
+}
+}  // namespace
+
+const uri_batch::offset_type uri_batch::npos;
+
+uri_batch::uri_batch() noexcept {}
+
+std::size_t uri_batch::size() const noexcept { return line_offsets_.size(); }
+
+bool uri_batch::empty() const noexcept { return line_offsets_.empty(); }
+
+uri_batch::string_view uri_batch::buffer() const noexcept { return buffer_; }
+
+uri_batch::string_view uri_batch::line(std::size_t index) const noexcept {
+  return buffer_.substr(line_offsets_[index], line_lengths_[index]);
+}
+
+bool uri_batch::is_valid(std::size_t index) const noexcept {
+  return ((valid_bits_[index / lines_per_word] >> (index % lines_per_word)) &
+          1u) != 0;
+}
+
+std::error_code uri_batch::error(std::size_t index) const {
+  if (is_valid(index)) {
+    return std::error_code();
+  }
+  return make_error_code(errors_[index]);
+}
+
+bool uri_batch::has(std::size_t index, component_type component) const
+    noexcept {
+  return first_[uri_batch::index(component)][index] != npos;
+}
+
+uri_batch::string_view uri_batch::component(std::size_t index,
+                                            component_type component) const
+    noexcept {
+  if (!has(index, component)) {
+    return string_view();
+  }
+
+  auto first = first_[uri_batch::index(component)][index];
+  auto last = last_[uri_batch::index(component)][index];
+  return line(index).substr(first, last - first);
+}
+
+const std::vector<std::size_t> &uri_batch::line_offsets() const noexcept {
+  return line_offsets_;
+}
+
+const std::vector<uri_batch::offset_type> &uri_batch::line_lengths() const
+    noexcept {
+  return line_lengths_;
+}
+
+const std::vector<uri_batch::offset_type> &uri_batch::first(
+    component_type component) const noexcept {
+  return first_[index(component)];
+}
+
+const std::vector<uri_batch::offset_type> &uri_batch::last(
+    component_type component) const noexcept {
+  return last_[index(component)];
+}
+
+const std::vector<std::uint64_t> &uri_batch::valid_bits() const noexcept {
+  return valid_bits_;
+}
+
+const std::vector<uri_error> &uri_batch::errors() const noexcept {
+  return errors_;
+}
+
+void uri_batch::parse_lines(std::size_t first, std::size_t last) noexcept {
+  for (auto i = first; i != last; ++i) {
+    auto raw_line = buffer_.substr(line_offsets_[i], line_lengths_[i]);
+    auto line = detail::trim_view(raw_line);
+    line_offsets_[i] += static_cast<std::size_t>(line.data() - raw_line.data());
+    line_lengths_[i] = static_cast<offset_type>(line.size());
+
+    detail::uri_parts parts;
+    auto it = std::begin(line), line_last = std::end(line);
+    detail::compact_uri_parts compact_parts;
+    // a line that fills the offset type may have been cut short
+    if (raw_line.size() >= npos) {
+      errors_[i] = uri_error::uri_too_long;
+    } else if (detail::parse(it, line_last, parts, errors_[i])) {
+      compact_parts = detail::compact_uri_parts(std::begin(line), parts);
+      valid_bits_[i / lines_per_word] |= std::uint64_t(1)
+                                         << (i % lines_per_word);
+    }
+
+    for (std::size_t c = 0; c < detail::compact_uri_parts::component_count;
+         ++c) {
+      auto component = static_cast<component_type>(c);
+      if (compact_parts.has(component)) {
+        first_[c][i] = compact_parts.first(component);
+        last_[c][i] = compact_parts.last(component);
+      } else {
+        first_[c][i] = npos;
+        last_[c][i] = npos;
+      }
+    }
+  }
+}
+
+uri_batch parse_batch(string_view buffer, unsigned threads) {
+  uri_batch batch;
+  batch.buffer_ = buffer;
+  find_lines(buffer, batch.line_offsets_, batch.line_lengths_);
+
+  const auto size = batch.line_offsets_.size();
+  for (std::size_t c = 0; c < detail::compact_uri_parts::component_count;
+       ++c) {
+    batch.first_[c].resize(size);
+    batch.last_[c].resize(size);
+  }
+  batch.valid_bits_.resize((size + lines_per_word - 1) / lines_per_word);
+  batch.errors_.resize(size);
+
+  if (threads == 0) {
+    threads = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+
+  // divide the lines evenly between the threads, in whole words
+  const auto words = batch.valid_bits_.size();
+  const auto lines_per_thread =
+      ((words + threads - 1) / threads) * lines_per_word;
+  if ((threads == 1) || (lines_per_thread >= size)) {
+    batch.parse_lines(0, size);
+    return batch;
+  }
+
+  std::vector<std::thread> workers;
+  try {
+    for (auto first = lines_per_thread; first < size;
+         first += lines_per_thread) {
+      auto last = std::min(first + lines_per_thread, size);
+      workers.emplace_back([&batch, first, last]() {
+        batch.parse_lines(first, last);
+      });
+    }
+  } catch (...) {
+    for (auto &worker : workers) {
+      worker.join();
+    }
+    throw;
+  }
+
+  batch.parse_lines(0, lines_per_thread);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  return batch;
+}
+}  // namespace network
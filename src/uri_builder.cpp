@@ -3,9 +3,9 @@
 // (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
-#include <locale>
 #include "network/uri/uri_builder.hpp"
 #include "detail/uri_normalize.hpp"
+#include "detail/uri_host.hpp"
 #include "detail/uri_parse_authority.hpp"
 #include "detail/algorithm.hpp"
 
@@ -47,8 +47,7 @@ network::uri uri_builder::uri() const { return network::uri(*this); }
 void uri_builder::set_scheme(string_type &&scheme) {
   // validate scheme is valid and normalize
   scheme_ = scheme;
-  detail::transform(*scheme_, std::begin(*scheme_),
-                    [](char ch) { return std::tolower(ch, std::locale()); });
+  detail::transform(*scheme_, std::begin(*scheme_), detail::to_lower_char);
 }
 
 void uri_builder::set_user_info(string_type &&user_info) {
@@ -66,8 +65,7 @@ void uri_builder::set_host(string_type &&host) {
   host_ = string_type();
   network::uri::encode_host(std::begin(host), std::end(host),
                             std::back_inserter(*host_));
-  detail::transform(*host_, std::begin(*host_),
-                    [](char ch) { return std::tolower(ch, std::locale()); });
+  detail::to_lower_in_place(&(*host_)[0], host_->size());
 }
 
 void uri_builder::set_port(string_type &&port) {
@@ -30,12 +30,34 @@ std::string uri_category_impl::message(int ev) const {
   switch (uri_error(ev)) {
     case uri_error::invalid_syntax:
       return "Unable to parse URI string.";
+    case uri_error::invalid_uri:
+      return "Invalid URI.";
+    case uri_error::invalid_scheme:
+      return "Invalid scheme.";
+    case uri_error::invalid_user_info:
+      return "Invalid user info.";
+    case uri_error::invalid_host:
+      return "Invalid host.";
+    case uri_error::invalid_port:
+      return "Invalid port.";
+    case uri_error::invalid_path:
+      return "Invalid path.";
+    case uri_error::invalid_query:
+      return "Invalid query.";
+    case uri_error::invalid_fragment:
+      return "Invalid fragment.";
     case uri_error::not_enough_input:
       return "Percent decoding: Not enough input.";
     case uri_error::non_hex_input:
       return "Percent decoding: Non-hex input.";
     case uri_error::conversion_failed:
       return "Percent decoding: Conversion failed.";
+    case uri_error::empty_uri:
+      return "The URI is empty.";
+    case uri_error::invalid_pct_encoded:
+      return "Invalid percent encoded character.";
+    case uri_error::uri_too_long:
+      return "The URI is too long.";
     default:
       break;
   }
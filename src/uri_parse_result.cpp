@@ -0,0 +1,54 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <limits>
+#include "network/uri/uri_parse_result.hpp"
+#include "detail/uri_parse.hpp"
+#include "detail/algorithm.hpp"
+
+namespace network {
+parse_result::parse_result() noexcept : error_(uri_error::empty_uri),
+                                        position_(0) {}
+
+parse_result::operator bool() const noexcept { return error_ == uri_error(); }
+
+uri_error parse_result::error() const noexcept { return error_; }
+
+std::size_t parse_result::position() const noexcept { return position_; }
+
+const uri_view &parse_result::view() const noexcept { return view_; }
+
+parse_result parse_uri(string_view source) noexcept {
+  parse_result result;
+  auto uri = detail::trim_view(source);
+  const auto offset = static_cast<std::size_t>(uri.data() - source.data());
+  result.position_ = offset;
+  if (uri.empty()) {
+    return result;
+  }
+
+  // the parts are stored as 32-bit offsets
+  const std::size_t max_size =
+      std::numeric_limits<detail::compact_uri_parts::offset_type>::max();
+  if (uri.size() > max_size) {
+    result.error_ = uri_error::uri_too_long;
+    result.position_ += max_size;
+    return result;
+  }
+
+  auto it = std::begin(uri), last = std::end(uri);
+  detail::uri_parts parts;
+  if (!detail::parse(it, last, parts, result.error_)) {
+    result.position_ += static_cast<std::size_t>(it - std::begin(uri));
+    return result;
+  }
+
+  result.view_ =
+      uri_view(uri, detail::compact_uri_parts(std::begin(uri), parts));
+  result.error_ = uri_error();
+  result.position_ += uri.size();
+  return result;
+}
+}  // namespace network
@@ -0,0 +1,266 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include "network/uri/uri_pool.hpp"
+#include "network/uri/uri_parse_result.hpp"
+
+namespace network {
+namespace {
+std::uint32_t hash_text(string_view text) noexcept {
+  auto hash = detail::hash_bytes(text.data(), text.size());
+  return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+}
+
+// The index is at most three quarters full.
+std::size_t index_capacity(std::size_t count) {
+  std::size_t capacity = 16;
+  while (capacity - (capacity / 4) < count) {
+    capacity *= 2;
+  }
+  return capacity;
+}
+
+bool parse(string_view source, uri_view &view) noexcept {
+  auto result = parse_uri(source);
+  view = result.view();
+  return result || (uri_error::empty_uri == result.error());
+}
+}  // namespace
+
+const uri_pool::handle_type uri_pool::npos;
+
+const std::size_t uri_pool::default_slab_size;
+
+uri_pool::uri_pool(uri_comparison_level level, std::size_t slab_size)
+    : level_(level),
+      slab_size_(std::max<std::size_t>(slab_size, 1)),
+      slab_next_(nullptr),
+      slab_left_(0),
+      slab_bytes_(0) {}
+
+uri_pool::uri_pool(uri_pool &&other) noexcept : uri_pool(other.level_) {
+  swap(other);
+}
+
+uri_pool &uri_pool::operator=(uri_pool &&other) noexcept {
+  uri_pool(std::move(other)).swap(*this);
+  return *this;
+}
+
+uri_pool::~uri_pool() {}
+
+void uri_pool::swap(uri_pool &other) noexcept {
+  std::swap(level_, other.level_);
+  std::swap(slab_size_, other.slab_size_);
+  slabs_.swap(other.slabs_);
+  std::swap(slab_next_, other.slab_next_);
+  std::swap(slab_left_, other.slab_left_);
+  std::swap(slab_bytes_, other.slab_bytes_);
+  entries_.swap(other.entries_);
+  index_.swap(other.index_);
+}
+
+uri_pool::handle_type uri_pool::insert(string_view source) {
+  uri_view view;
+  if (!parse(source, view)) {
+    throw uri_syntax_error();
+  }
+  return insert(view);
+}
+
+uri_pool::handle_type uri_pool::insert(string_view source,
+                                       std::error_code &ec) {
+  uri_view view;
+  if (!parse(source, view)) {
+    ec = make_error_code(uri_error::invalid_syntax);
+    return npos;
+  }
+  return insert(view);
+}
+
+uri_pool::handle_type uri_pool::insert(const uri_view &view) {
+  if (uri_comparison_level::string_comparison == level_) {
+    return intern(view.view(), view.uri_parts_);
+  }
+  return insert(uri(view));
+}
+
+uri_pool::handle_type uri_pool::insert(const uri &other) {
+  if (uri_comparison_level::string_comparison == level_) {
+    return intern(other.view(), other.uri_parts_);
+  }
+  auto normalized = other.normalize(level_);
+  return intern(normalized.view(), normalized.uri_parts_);
+}
+
+std::vector<uri_pool::handle_type> uri_pool::insert(const uri_batch &batch) {
+  std::vector<handle_type> handles(batch.size(), npos);
+  reserve(size() + batch.size());
+  for (std::size_t i = 0; i < batch.size(); ++i) {
+    if (!batch.is_valid(i)) {
+      continue;
+    }
+
+    detail::compact_uri_parts parts;
+    for (std::size_t c = 0; c < detail::compact_uri_parts::component_count;
+         ++c) {
+      auto component = static_cast<uri_batch::component_type>(c);
+      if (batch.has(i, component)) {
+        parts.set(component, batch.first(component)[i],
+                  batch.last(component)[i]);
+      }
+    }
+    handles[i] = insert(uri_view(batch.line(i), parts));
+  }
+  return handles;
+}
+
+uri_pool::handle_type uri_pool::find(string_view source) const {
+  uri_view view;
+  if (!parse(source, view)) {
+    return npos;
+  }
+  return find(view);
+}
+
+uri_pool::handle_type uri_pool::find(const uri_view &view) const {
+  if (uri_comparison_level::string_comparison == level_) {
+    return lookup(view.view(), hash_text(view.view()));
+  }
+  auto normalized = uri(view).normalize(level_);
+  return lookup(normalized.view(), hash_text(normalized.view()));
+}
+
+uri_view uri_pool::operator[](handle_type handle) const noexcept {
+  const auto &instance = entries_[handle];
+  return uri_view(string_view(instance.data, instance.size), instance.parts);
+}
+
+std::size_t uri_pool::size() const noexcept { return entries_.size(); }
+
+bool uri_pool::empty() const noexcept { return entries_.empty(); }
+
+uri_comparison_level uri_pool::level() const noexcept { return level_; }
+
+void uri_pool::reserve(std::size_t count) {
+  if (count > entries_.capacity()) {
+    entries_.reserve(count);
+  }
+  if (index_capacity(count) > index_.size()) {
+    rehash(index_capacity(count));
+  }
+}
+
+std::size_t uri_pool::allocated_bytes() const noexcept {
+  return slab_bytes_ + (entries_.capacity() * sizeof(entry)) +
+         (index_.capacity() * sizeof(slot)) +
+         (slabs_.capacity() * sizeof(std::unique_ptr<char[]>));
+}
+
+void uri_pool::clear() noexcept { uri_pool(level_, slab_size_).swap(*this); }
+
+uri_pool::handle_type uri_pool::intern(string_view text,
+                                       const detail::compact_uri_parts &parts) {
+  const auto hash = hash_text(text);
+  auto handle = lookup(text, hash);
+  if (handle != npos) {
+    return handle;
+  }
+
+  if (entries_.size() >= npos) {
+    throw std::length_error("The uri_pool is full.");
+  }
+  if (index_capacity(entries_.size() + 1) > index_.size()) {
+    rehash(index_capacity(entries_.size() + 1));
+  }
+
+  entry instance;
+  instance.data = allocate(text.size());
+  if (!text.empty()) {
+    std::memcpy(const_cast<char *>(instance.data), text.data(), text.size());
+  }
+  instance.size = static_cast<std::uint32_t>(text.size());
+  instance.parts = parts;
+  entries_.push_back(instance);
+
+  handle = static_cast<handle_type>(entries_.size() - 1);
+  const auto mask = index_.size() - 1;
+  auto i = hash & mask;
+  while (index_[i].handle != npos) {
+    i = (i + 1) & mask;
+  }
+  index_[i].hash = hash;
+  index_[i].handle = handle;
+  return handle;
+}
+
+uri_pool::handle_type uri_pool::lookup(string_view text,
+                                       std::uint32_t hash) const noexcept {
+  if (index_.empty()) {
+    return npos;
+  }
+
+  const auto mask = index_.size() - 1;
+  for (auto i = hash & mask; index_[i].handle != npos; i = (i + 1) & mask) {
+    if (index_[i].hash == hash) {
+      const auto &instance = entries_[index_[i].handle];
+      if ((instance.size == text.size()) &&
+          (text.empty() ||
+           (std::memcmp(instance.data, text.data(), text.size()) == 0))) {
+        return index_[i].handle;
+      }
+    }
+  }
+  return npos;
+}
+
+char *uri_pool::allocate(std::size_t size) {
+  if (size == 0) {
+    return slab_next_;
+  }
+
+  // a URI that is longer than a slab has a slab of its own, and the
+  // current slab is kept for the URIs that follow it
+  if (size > slab_size_) {
+    slabs_.emplace_back(new char[size]);
+    slab_bytes_ += size;
+    return slabs_.back().get();
+  }
+
+  if (size > slab_left_) {
+    slabs_.emplace_back(new char[slab_size_]);
+    slab_bytes_ += slab_size_;
+    slab_next_ = slabs_.back().get();
+    slab_left_ = slab_size_;
+  }
+
+  auto data = slab_next_;
+  slab_next_ += size;
+  slab_left_ -= size;
+  return data;
+}
+
+void uri_pool::rehash(std::size_t capacity) {
+  slot empty_slot;
+  empty_slot.hash = 0;
+  empty_slot.handle = npos;
+  std::vector<slot> index(capacity, empty_slot);
+  const auto mask = capacity - 1;
+  for (const auto &existing : index_) {
+    if (existing.handle != npos) {
+      auto i = existing.hash & mask;
+      while (index[i].handle != npos) {
+        i = (i + 1) & mask;
+      }
+      index[i] = existing;
+    }
+  }
+  index_.swap(index);
+}
+}  // namespace network
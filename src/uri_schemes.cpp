@@ -0,0 +1,202 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "network/uri/uri_schemes.hpp"
+#include "network/uri/uri_errors.hpp"
+#include "network/uri/detail/grammar.hpp"
+
+namespace network {
+namespace {
+struct builtin_scheme {
+  const char *name;
+  std::size_t size;
+  const char *default_port;
+  std::size_t default_port_size;
+};
+
+// The schemes whose default ports are known without being registered.
+constexpr builtin_scheme builtin_schemes[] = {
+    {"http", 4, "80", 2}, {"https", 5, "443", 3}, {"ws", 2, "80", 2},
+    {"wss", 3, "443", 3}, {"ftp", 3, "21", 2},
+};
+
+constexpr std::size_t builtin_count =
+    sizeof(builtin_schemes) / sizeof(builtin_schemes[0]);
+
+// The built-in schemes are found with a perfect hash of the first and
+// last characters and the length, and the multiplier of the first
+// character is chosen at compile time so that no two schemes share a
+// slot.
+constexpr std::size_t table_size = 8, max_multiplier = 64;
+
+constexpr std::size_t slot(std::size_t multiplier, char first, char last,
+                           std::size_t size) {
+  return ((static_cast<unsigned char>(first) * multiplier) +
+          static_cast<unsigned char>(last) + size) %
+         table_size;
+}
+
+constexpr std::size_t builtin_slot(std::size_t multiplier, std::size_t i) {
+  return slot(multiplier, builtin_schemes[i].name[0],
+              builtin_schemes[i].name[builtin_schemes[i].size - 1],
+              builtin_schemes[i].size);
+}
+
+constexpr bool is_unique(std::size_t multiplier, std::size_t i,
+                         std::size_t j) {
+  return (j == builtin_count) ||
+         ((builtin_slot(multiplier, i) != builtin_slot(multiplier, j)) &&
+          is_unique(multiplier, i, j + 1));
+}
+
+constexpr bool is_perfect(std::size_t multiplier, std::size_t i = 0) {
+  return (i == builtin_count) ||
+         (is_unique(multiplier, i, i + 1) && is_perfect(multiplier, i + 1));
+}
+
+constexpr std::size_t find_multiplier(std::size_t multiplier = 1) {
+  return ((multiplier == max_multiplier) || is_perfect(multiplier))
+             ? multiplier
+             : find_multiplier(multiplier + 1);
+}
+
+constexpr std::size_t multiplier = find_multiplier();
+static_assert(multiplier != max_multiplier,
+              "The built-in schemes need a larger table.");
+
+constexpr unsigned char builtin_in_slot(std::size_t s, std::size_t i = 0) {
+  return (i == builtin_count)
+             ? static_cast<unsigned char>(builtin_count)
+             : ((builtin_slot(multiplier, i) == s)
+                    ? static_cast<unsigned char>(i)
+                    : builtin_in_slot(s, i + 1));
+}
+
+template <class Slots>
+struct slot_table;
+
+template <std::size_t... Slots>
+struct slot_table<detail::index_list<Slots...> > {
+  static constexpr unsigned char value[sizeof...(Slots)] = {
+      builtin_in_slot(Slots)...};
+};
+
+template <std::size_t... Slots>
+constexpr unsigned char
+    slot_table<detail::index_list<Slots...> >::value[sizeof...(Slots)];
+
+typedef slot_table<detail::make_index_list<table_size>::type> builtin_slots;
+
+bool equal_to_lower(string_view scheme, const char *name) noexcept {
+  for (const auto c : scheme) {
+    if (detail::to_lower_char(c) != *name++) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The registered schemes are copied into a new table each time one is
+// added, so that they can be read without a lock. The old tables are
+// kept, because another thread may still be reading one, and none are
+// ever freed, so that they can still be read while the program exits.
+struct registered_scheme {
+  std::string name, default_port;
+};
+
+struct registered_schemes {
+  std::vector<registered_scheme> schemes;
+  std::unique_ptr<const registered_schemes> previous;
+};
+
+std::atomic<const registered_schemes *> registered(nullptr);
+
+std::mutex registration_mutex;
+
+std::unique_ptr<const registered_schemes> &registration_owner() {
+  static auto owner = new std::unique_ptr<const registered_schemes>();
+  return *owner;
+}
+
+string_view trim_zeros(string_view port) noexcept {
+  while ((port.size() > 1) && (port.front() == '0')) {
+    port.remove_prefix(1);
+  }
+  return port;
+}
+}  // namespace
+
+void register_uri_scheme(string_view scheme, string_view default_port) {
+  if (scheme.empty() || !detail::is_alpha_char(scheme.front())) {
+    throw std::system_error(make_error_code(uri_error::invalid_scheme));
+  }
+  for (const auto c : scheme) {
+    if (!detail::is_char_class(c, detail::scheme_char)) {
+      throw std::system_error(make_error_code(uri_error::invalid_scheme));
+    }
+  }
+  if (default_port.empty()) {
+    throw std::system_error(make_error_code(uri_error::invalid_port));
+  }
+  for (const auto c : default_port) {
+    if (!detail::is_digit_char(c)) {
+      throw std::system_error(make_error_code(uri_error::invalid_port));
+    }
+  }
+
+  registered_scheme added;
+  for (const auto c : scheme) {
+    added.name.push_back(detail::to_lower_char(c));
+  }
+  added.default_port = trim_zeros(default_port).to_string();
+
+  std::lock_guard<std::mutex> lock(registration_mutex);
+  auto &owner = registration_owner();
+  std::unique_ptr<registered_schemes> table(new registered_schemes);
+  if (owner) {
+    for (const auto &existing : owner->schemes) {
+      if (existing.name != added.name) {
+        table->schemes.push_back(existing);
+      }
+    }
+  }
+  table->schemes.push_back(std::move(added));
+  table->previous = std::move(owner);
+  owner.reset(table.release());
+  registered.store(owner.get(), std::memory_order_release);
+}
+
+optional<string_view> find_default_port(string_view scheme) noexcept {
+  if (scheme.empty()) {
+    return nullopt;
+  }
+
+  const auto table = registered.load(std::memory_order_acquire);
+  if (table != nullptr) {
+    for (const auto &existing : table->schemes) {
+      if ((existing.name.size() == scheme.size()) &&
+          equal_to_lower(scheme, existing.name.c_str())) {
+        return string_view(existing.default_port);
+      }
+    }
+  }
+
+  const auto i = builtin_slots::value[slot(
+      multiplier, detail::to_lower_char(scheme.front()),
+      detail::to_lower_char(scheme.back()), scheme.size())];
+  if ((i != builtin_count) && (builtin_schemes[i].size == scheme.size()) &&
+      equal_to_lower(scheme, builtin_schemes[i].name)) {
+    return string_view(builtin_schemes[i].default_port,
+                       builtin_schemes[i].default_port_size);
+  }
+  return nullopt;
+}
+}  // namespace network
@@ -0,0 +1,100 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <limits>
+#include "network/uri/uri_view.hpp"
+#include "detail/uri_parse.hpp"
+#include "detail/algorithm.hpp"
+
+namespace network {
+uri_view::uri_view(string_view source) {
+  if (!initialize(source)) {
+    throw uri_syntax_error();
+  }
+}
+
+uri_view::uri_view(string_view source, std::error_code &ec) noexcept {
+  if (!initialize(source)) {
+    ec = make_error_code(uri_error::invalid_syntax);
+  }
+}
+
+uri_view::query_iterator uri_view::query_begin() const noexcept {
+  if (!has_query()) {
+    return query_iterator{};
+  }
+
+  auto query = this->query();
+  return query_iterator{detail::uri_part(std::begin(query), std::end(query))};
+}
+
+uri_view::query_iterator uri_view::query_end() const noexcept {
+  return query_iterator{};
+}
+
+uri_view::string_view uri_view::authority() const noexcept {
+  if (!has_host()) {
+    return string_view{};
+  }
+
+  auto host = this->host();
+
+  auto user_info = string_view{};
+  if (has_user_info()) {
+    user_info = this->user_info();
+  }
+
+  auto port = string_view{};
+  if (has_port()) {
+    port = this->port();
+  }
+
+  auto first = std::begin(host), last = std::end(host);
+  if (has_user_info() && !user_info.empty()) {
+    first = std::begin(user_info);
+  } else if (host.empty() && has_port() && !port.empty()) {
+    first = std::begin(port);
+    --first;  // include ':' before port
+  }
+
+  if (host.empty()) {
+    if (has_port() && !port.empty()) {
+      last = std::end(port);
+    } else if (has_user_info() && !user_info.empty()) {
+      last = std::end(user_info);
+      ++last;  // include '@'
+    }
+  } else if (has_port()) {
+    if (port.empty()) {
+      ++last;  // include ':' after host
+    } else {
+      last = std::end(port);
+    }
+  }
+
+  return string_view(first, std::distance(first, last));
+}
+
+std::string uri_view::string() const { return uri_.to_string(); }
+
+bool uri_view::initialize(string_view uri) noexcept {
+  uri_ = detail::trim_view(uri);
+  if (!uri_.empty()) {
+    // the parts are stored as 32-bit offsets
+    if (uri_.size() > std::numeric_limits<
+                          detail::compact_uri_parts::offset_type>::max()) {
+      uri_ = string_view();
+      return false;
+    }
+
+    const_iterator it = std::begin(uri_), last = std::end(uri_);
+    detail::uri_parts parts;
+    bool is_valid = detail::parse(it, last, parts);
+    uri_parts_ = detail::compact_uri_parts(std::begin(uri_), parts);
+    return is_valid;
+  }
+  return true;
+}
+}  // namespace network
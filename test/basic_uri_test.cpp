@@ -0,0 +1,263 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <network/uri.hpp>
+#include "string_utility.hpp"
+
+namespace {
+// An allocator that counts the bytes that it has allocated and not
+// yet freed.
+template <class T>
+struct counting_allocator {
+  typedef T value_type;
+
+  explicit counting_allocator(std::ptrdiff_t *bytes) : bytes(bytes) {}
+
+  template <class U>
+  counting_allocator(const counting_allocator<U> &other) : bytes(other.bytes) {}
+
+  T *allocate(std::size_t n) {
+    *bytes += static_cast<std::ptrdiff_t>(n * sizeof(T));
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *p, std::size_t n) {
+    *bytes -= static_cast<std::ptrdiff_t>(n * sizeof(T));
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  std::ptrdiff_t *bytes;
+};
+
+template <class T, class U>
+bool operator==(const counting_allocator<T> &lhs,
+                const counting_allocator<U> &rhs) {
+  return lhs.bytes == rhs.bytes;
+}
+
+template <class T, class U>
+bool operator!=(const counting_allocator<T> &lhs,
+                const counting_allocator<U> &rhs) {
+  return !(lhs == rhs);
+}
+
+typedef counting_allocator<char> allocator;
+typedef network::basic_uri<allocator> counted_uri;
+
+// long enough not to fit in the small string buffer
+const char long_uri[] =
+    "http://user@www.example.com:8080/a/long/path/to/a/resource.html"
+    "?query=value#fragment";
+}  // namespace
+
+TEST(basic_uri_test, construct_with_allocator) {
+  std::ptrdiff_t bytes = 0;
+  {
+    counted_uri instance(long_uri, allocator(&bytes));
+    EXPECT_LT(0, bytes);
+    EXPECT_EQ(long_uri, instance.view());
+    EXPECT_EQ("http", instance.scheme());
+    EXPECT_EQ("user", instance.user_info());
+    EXPECT_EQ("www.example.com", instance.host());
+    EXPECT_EQ("8080", instance.port());
+    EXPECT_EQ(8080, instance.port<int>());
+    EXPECT_EQ("/a/long/path/to/a/resource.html", instance.path());
+    EXPECT_EQ("query=value", instance.query());
+    EXPECT_EQ("fragment", instance.fragment());
+    EXPECT_EQ("user@www.example.com:8080", instance.authority());
+    EXPECT_TRUE(instance.is_absolute());
+    EXPECT_FALSE(instance.is_opaque());
+  }
+  EXPECT_EQ(0, bytes);
+}
+
+TEST(basic_uri_test, default_constructed_basic_uri_is_empty) {
+  std::ptrdiff_t bytes = 0;
+  counted_uri instance{allocator(&bytes)};
+  EXPECT_TRUE(instance.empty());
+  EXPECT_FALSE(instance.has_scheme());
+  EXPECT_EQ(&bytes, instance.get_allocator().bytes);
+}
+
+TEST(basic_uri_test, whitespace_is_ignored) {
+  std::ptrdiff_t bytes = 0;
+  counted_uri instance("  http://www.example.com/  ", allocator(&bytes));
+  EXPECT_EQ("http://www.example.com/", instance.view());
+  EXPECT_TRUE(counted_uri("   ", allocator(&bytes)).empty());
+}
+
+TEST(basic_uri_test, construct_invalid_basic_uri) {
+  std::ptrdiff_t bytes = 0;
+  EXPECT_THROW(counted_uri("I am not a valid URI.", allocator(&bytes)),
+               network::uri_syntax_error);
+}
+
+TEST(basic_uri_test, construct_invalid_basic_uri_with_error_code) {
+  std::ptrdiff_t bytes = 0;
+  std::error_code ec;
+  counted_uri instance("I am not a valid URI.", ec, allocator(&bytes));
+  EXPECT_EQ(network::make_error_code(network::uri_error::invalid_syntax), ec);
+}
+
+TEST(basic_uri_test, construct_from_uri_and_uri_view) {
+  std::ptrdiff_t bytes = 0;
+  network::uri original(long_uri);
+  counted_uri from_uri(original, allocator(&bytes));
+  network::uri_view view(long_uri);
+  counted_uri from_view(view, allocator(&bytes));
+  EXPECT_EQ(original.view(), from_uri.view());
+  EXPECT_EQ(original.query(), from_uri.query());
+  EXPECT_EQ(from_uri, from_view);
+  EXPECT_EQ(from_uri.as_view(), network::uri_view(long_uri));
+}
+
+TEST(basic_uri_test, copy_with_allocator) {
+  std::ptrdiff_t first_bytes = 0, second_bytes = 0;
+  counted_uri instance(long_uri, allocator(&first_bytes));
+  counted_uri copy(instance, allocator(&second_bytes));
+  EXPECT_EQ(instance, copy);
+  EXPECT_EQ(first_bytes, second_bytes);
+  EXPECT_EQ("www.example.com", copy.host());
+}
+
+TEST(basic_uri_test, move_keeps_the_allocator) {
+  std::ptrdiff_t bytes = 0;
+  counted_uri instance(long_uri, allocator(&bytes));
+  const auto allocated = bytes;
+  counted_uri moved(std::move(instance));
+  EXPECT_EQ(allocated, bytes);
+  EXPECT_EQ(&bytes, moved.get_allocator().bytes);
+  EXPECT_EQ("www.example.com", moved.host());
+  EXPECT_TRUE(instance.empty());
+  EXPECT_FALSE(instance.has_host());
+}
+
+TEST(basic_uri_test, move_assignment) {
+  std::ptrdiff_t bytes = 0;
+  counted_uri instance(long_uri, allocator(&bytes));
+  counted_uri other{allocator(&bytes)};
+  other = std::move(instance);
+  EXPECT_EQ("/a/long/path/to/a/resource.html", other.path());
+  EXPECT_TRUE(instance.empty());
+}
+
+TEST(basic_uri_test, swap) {
+  std::ptrdiff_t bytes = 0;
+  counted_uri first("http://a.example.com/", allocator(&bytes));
+  counted_uri second("mailto:john.doe@example.com", allocator(&bytes));
+  swap(first, second);
+  EXPECT_EQ("john.doe@example.com", first.path());
+  EXPECT_EQ("a.example.com", second.host());
+}
+
+TEST(basic_uri_test, query_iterator) {
+  std::ptrdiff_t bytes = 0;
+  counted_uri instance("http://example.com/?a=1&b=2", allocator(&bytes));
+  auto it = instance.query_begin();
+  ASSERT_NE(instance.query_end(), it);
+  EXPECT_EQ("a", it->first);
+  EXPECT_EQ("1", it->second);
+  ++it;
+  ASSERT_NE(instance.query_end(), it);
+  EXPECT_EQ("b", it->first);
+  ++it;
+  EXPECT_EQ(instance.query_end(), it);
+}
+
+TEST(basic_uri_test, builder) {
+  std::ptrdiff_t bytes = 0;
+  network::uri_builder builder;
+  builder.scheme("http").host("www.example.com").path("path/to/resource");
+  auto instance = builder.uri(allocator(&bytes));
+  EXPECT_EQ("http://www.example.com/path/to/resource", instance.view());
+  EXPECT_EQ("/path/to/resource", instance.path());
+  EXPECT_EQ(builder.uri().view(), instance.view());
+  EXPECT_EQ(&bytes, instance.get_allocator().bytes);
+}
+
+TEST(basic_uri_test, invalid_builder) {
+  std::ptrdiff_t bytes = 0;
+  network::uri_builder builder;
+  builder.scheme("http");
+  EXPECT_THROW(builder.uri(allocator(&bytes)), network::uri_builder_error);
+}
+
+TEST(basic_uri_test, normalize) {
+  std::ptrdiff_t bytes = 0;
+  counted_uri instance("HTTP://www.example.com/a/./b/../c/%7euser",
+                       allocator(&bytes));
+  auto normalized =
+      instance.normalize(network::uri_comparison_level::syntax_based);
+  EXPECT_EQ("http://www.example.com/a/c/~user", normalized.view());
+  EXPECT_EQ(&bytes, normalized.get_allocator().bytes);
+  EXPECT_EQ(0, instance.compare(normalized,
+                                network::uri_comparison_level::syntax_based));
+  EXPECT_NE(0,
+            instance.compare(normalized,
+                             network::uri_comparison_level::string_comparison));
+}
+
+TEST(basic_uri_test, resolve_and_make_relative) {
+  std::ptrdiff_t bytes = 0;
+  counted_uri base("http://a/b/c/d;p?q", allocator(&bytes));
+  auto reference = network::uri_builder().path("../g").uri(allocator(&bytes));
+  auto resolved = reference.resolve(base);
+  EXPECT_EQ("http://a/b/g", resolved.view());
+  EXPECT_EQ(&bytes, resolved.get_allocator().bytes);
+
+  counted_uri root("http://a/", allocator(&bytes));
+  EXPECT_EQ("/b/g", root.make_relative(resolved).view());
+}
+
+TEST(basic_uri_test, comparison_operators) {
+  std::ptrdiff_t bytes = 0;
+  counted_uri first("http://a.example.com/", allocator(&bytes));
+  counted_uri second("http://b.example.com/", allocator(&bytes));
+  EXPECT_TRUE(first == "http://a.example.com/");
+  EXPECT_TRUE(first != second);
+  EXPECT_TRUE(first < second);
+  EXPECT_TRUE(second > first);
+  EXPECT_TRUE(first <= first);
+  EXPECT_TRUE(second >= first);
+}
+
+TEST(basic_uri_test, vector_with_scoped_allocator) {
+  std::ptrdiff_t bytes = 0;
+  std::vector<counted_uri, counting_allocator<counted_uri>> uris{
+      counting_allocator<counted_uri>(&bytes)};
+  uris.emplace_back(long_uri, allocator(&bytes));
+  uris.emplace_back(network::uri_view("http://www.example.com/"),
+                    allocator(&bytes));
+  EXPECT_EQ("www.example.com", uris.back().host());
+  uris.clear();
+  uris.shrink_to_fit();
+  EXPECT_EQ(0, bytes);
+}
+
+#if defined(NETWORK_URI_HAS_MEMORY_RESOURCE)
+TEST(basic_uri_test, pmr_uri_in_a_monotonic_buffer) {
+  // the upstream resource throws, so everything must fit in the buffer
+  char buffer[4096];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  std::pmr::vector<network::pmr::uri> uris(&arena);
+  uris.reserve(4);
+  uris.emplace_back(long_uri);
+  uris.emplace_back("http://www.example.com/");
+  uris.push_back(network::uri_builder()
+                     .scheme("https")
+                     .host("www.example.com")
+                     .path("/a/long/path/to/a/resource.html")
+                     .uri(network::pmr::uri::allocator_type(&arena)));
+  EXPECT_EQ(&arena, uris[0].get_allocator().resource());
+  EXPECT_EQ(&arena, uris[2].get_allocator().resource());
+  EXPECT_EQ("www.example.com", uris[2].host());
+}
+#endif  // defined(NETWORK_URI_HAS_MEMORY_RESOURCE)
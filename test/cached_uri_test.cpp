@@ -0,0 +1,181 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <network/uri.hpp>
+#include "string_utility.hpp"
+
+namespace {
+const auto syntax_based = network::uri_comparison_level::syntax_based;
+}  // namespace
+
+TEST(cached_uri_test, default_constructed_uri_is_empty) {
+  network::cached_uri instance;
+  EXPECT_TRUE(instance.get().empty());
+  EXPECT_TRUE(instance.normalize(syntax_based).empty());
+}
+
+TEST(cached_uri_test, normalize) {
+  network::cached_uri instance("HTTP://www.example.com/a/../%7eb");
+  const auto &normalized = instance.normalize(syntax_based);
+  EXPECT_EQ("http://www.example.com/~b", normalized.view());
+  EXPECT_EQ("HTTP://www.example.com/a/../%7eb", instance.view());
+}
+
+TEST(cached_uri_test, normalize_is_computed_once) {
+  network::cached_uri instance("HTTP://www.example.com/");
+  const auto &normalized = instance.normalize(syntax_based);
+  EXPECT_EQ(&normalized, &instance.normalize(syntax_based));
+  EXPECT_NE(&normalized, &instance.get());
+}
+
+TEST(cached_uri_test, normalized_uri_is_itself) {
+  network::cached_uri instance("http://www.example.com/a/~b?%2F");
+  EXPECT_EQ(&instance.get(), &instance.normalize(syntax_based));
+  EXPECT_EQ(&instance.get(),
+            &instance.normalize(network::uri_comparison_level::scheme_based));
+  EXPECT_EQ(&instance.get(),
+            &instance.normalize(
+                network::uri_comparison_level::string_comparison));
+}
+
+TEST(cached_uri_test, normalize_throws) {
+  network::cached_uri instance("http://www.example.com/..");
+  EXPECT_THROW(instance.normalize(syntax_based), network::uri_builder_error);
+  EXPECT_EQ(0, instance.compare(network::cached_uri("http://www.example.com/"),
+                                syntax_based));
+}
+
+TEST(cached_uri_test, normalize_throws_every_time) {
+  network::cached_uri instance("http://www.example.com/..");
+  const network::cached_uri other("HTTP://www.example.com/");
+  for (auto i = 0; i < 2; ++i) {
+    EXPECT_THROW(instance.normalize(syntax_based), network::uri_builder_error);
+    EXPECT_EQ(0, instance.compare(other, syntax_based));
+    EXPECT_EQ(instance.get().hash(syntax_based), instance.hash(syntax_based));
+  }
+  network::cached_uri copy(instance);
+  EXPECT_THROW(copy.normalize(syntax_based), network::uri_builder_error);
+  EXPECT_EQ(0, copy.compare(other, syntax_based));
+}
+
+TEST(cached_uri_test, copy_keeps_a_normalized_uri) {
+  network::cached_uri instance("http://www.example.com/");
+  instance.normalize(syntax_based);
+  network::cached_uri copy(instance);
+  EXPECT_EQ(&copy.get(), &copy.normalize(syntax_based));
+
+  network::cached_uri other("HTTP://www.example.com/");
+  other.normalize(syntax_based);
+  network::cached_uri other_copy(other);
+  EXPECT_EQ("http://www.example.com/",
+            other_copy.normalize(syntax_based).view());
+  EXPECT_NE(&other.normalize(syntax_based),
+            &other_copy.normalize(syntax_based));
+}
+
+TEST(cached_uri_test, move_keeps_the_normalized_uri) {
+  network::cached_uri instance("HTTP://www.example.com/");
+  const auto *normalized = &instance.normalize(syntax_based);
+  network::cached_uri moved(std::move(instance));
+  EXPECT_EQ(normalized, &moved.normalize(syntax_based));
+
+  network::cached_uri other("http://www.example.com/");
+  other.normalize(syntax_based);
+  network::cached_uri other_moved(std::move(other));
+  EXPECT_EQ(&other_moved.get(), &other_moved.normalize(syntax_based));
+}
+
+TEST(cached_uri_test, swap) {
+  network::cached_uri lhs("HTTP://www.example.com/"),
+      rhs("http://www.example.org/");
+  const auto *normalized = &lhs.normalize(syntax_based);
+  rhs.normalize(syntax_based);
+  lhs.swap(rhs);
+  EXPECT_EQ(&lhs.get(), &lhs.normalize(syntax_based));
+  EXPECT_EQ(normalized, &rhs.normalize(syntax_based));
+  EXPECT_EQ("http://www.example.org/", lhs.view());
+  EXPECT_EQ("http://www.example.com/", rhs.normalize(syntax_based).view());
+}
+
+TEST(cached_uri_test, assignment) {
+  network::cached_uri instance("HTTP://www.example.com/"),
+      other("http://www.example.org/");
+  instance.normalize(syntax_based);
+  instance = other;
+  EXPECT_EQ("http://www.example.org/", instance.view());
+  EXPECT_EQ("http://www.example.org/",
+            instance.normalize(syntax_based).view());
+}
+
+TEST(cached_uri_test, compare_and_hash_agree_with_uri) {
+  const char *sources[] = {
+      "http://www.example.com/",    "HTTP://www.example.com/",
+      "http://www.example.com",     "http://www.example.com/%7E",
+      "http://www.example.com/~",   "http://www.example.com/a/../b",
+      "http://www.example.com/..",  "http://www.example.org/",
+  };
+  for (auto lhs : sources) {
+    for (auto rhs : sources) {
+      network::cached_uri lhs_cached(lhs), rhs_cached(rhs);
+      network::uri lhs_uri(lhs), rhs_uri(rhs);
+      EXPECT_EQ(lhs_uri.compare(rhs_uri, syntax_based),
+                lhs_cached.compare(rhs_cached, syntax_based))
+          << lhs << " " << rhs;
+    }
+    EXPECT_EQ(network::uri(lhs).hash(syntax_based),
+              network::cached_uri(lhs).hash(syntax_based))
+        << lhs;
+  }
+}
+
+TEST(cached_uri_test, unordered_set_of_normalized_uris) {
+  std::unordered_set<network::cached_uri, network::normalized_uri_hash,
+                     network::normalized_uri_equal>
+      uris;
+  uris.emplace("HTTP://www.example.com/a/../b");
+  uris.emplace("http://www.example.com/%62");
+  EXPECT_EQ(1u, uris.size());
+  EXPECT_EQ(1u, uris.count(network::cached_uri("http://www.example.com/b")));
+}
+
+TEST(cached_uri_test, normalize_on_different_threads) {
+  const network::cached_uri instance("HTTP://www.example.com/a/../b");
+  std::vector<const network::uri *> normalized(8);
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < normalized.size(); ++i) {
+    threads.emplace_back([&instance, &normalized, i]() {
+      normalized[i] = &instance.normalize(syntax_based);
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (auto result : normalized) {
+    EXPECT_EQ(normalized[0], result);
+  }
+  EXPECT_EQ("http://www.example.com/b", normalized[0]->view());
+}
+
+TEST(cached_uri_test, hash_of_the_string) {
+  network::cached_uri instance("HTTP://www.example.com/"), empty;
+  EXPECT_EQ(network::uri("HTTP://www.example.com/").hash(), instance.hash());
+  EXPECT_EQ(instance.hash(), std::hash<network::cached_uri>()(instance));
+  EXPECT_EQ(instance.hash(),
+            instance.hash(network::uri_comparison_level::string_comparison));
+  EXPECT_EQ(network::uri().hash(), empty.hash());
+
+  network::cached_uri moved(std::move(instance));
+  EXPECT_EQ(network::uri("HTTP://www.example.com/").hash(), moved.hash());
+  moved.swap(empty);
+  EXPECT_EQ(network::uri().hash(), moved.hash());
+  EXPECT_EQ(network::uri("HTTP://www.example.com/").hash(), empty.hash());
+}
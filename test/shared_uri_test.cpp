@@ -0,0 +1,165 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <network/uri.hpp>
+#include "string_utility.hpp"
+
+namespace {
+const char full_uri[] = "http://user@www.example.com:8080/path?query#fragment";
+}  // namespace
+
+TEST(shared_uri_test, default_constructed_shared_uri_is_empty) {
+  network::shared_uri instance;
+  EXPECT_TRUE(instance.empty());
+  EXPECT_EQ(0u, instance.use_count());
+  EXPECT_FALSE(instance.has_scheme());
+  EXPECT_EQ("", instance.view());
+}
+
+TEST(shared_uri_test, components) {
+  network::shared_uri instance(full_uri);
+  EXPECT_EQ(1u, instance.use_count());
+  EXPECT_EQ("http", instance.scheme());
+  EXPECT_EQ("user", instance.user_info());
+  EXPECT_EQ("www.example.com", instance.host());
+  EXPECT_EQ("8080", instance.port());
+  EXPECT_EQ(8080, instance.port<int>());
+  EXPECT_EQ("/path", instance.path());
+  EXPECT_EQ("query", instance.query());
+  EXPECT_EQ("fragment", instance.fragment());
+  EXPECT_EQ("user@www.example.com:8080", instance.authority());
+}
+
+TEST(shared_uri_test, whitespace_is_ignored) {
+  network::shared_uri instance("  http://www.example.com/  ");
+  EXPECT_EQ("http://www.example.com/", instance.view());
+  EXPECT_TRUE(network::shared_uri("   ").empty());
+}
+
+TEST(shared_uri_test, construct_invalid_shared_uri) {
+  EXPECT_THROW(network::shared_uri("I am not a valid URI."),
+               network::uri_syntax_error);
+}
+
+TEST(shared_uri_test, construct_invalid_shared_uri_with_error_code) {
+  std::error_code ec;
+  network::shared_uri instance("I am not a valid URI.", ec);
+  EXPECT_EQ(network::make_error_code(network::uri_error::invalid_syntax), ec);
+}
+
+TEST(shared_uri_test, construct_from_uri_and_uri_view) {
+  network::uri original(full_uri);
+  network::shared_uri from_uri(original);
+  network::uri_view view(full_uri);
+  network::shared_uri from_view(view);
+  EXPECT_EQ(original.view(), from_uri.view());
+  EXPECT_EQ(original.query(), from_uri.query());
+  EXPECT_EQ(from_uri, from_view);
+  EXPECT_EQ(view, from_view.as_view());
+}
+
+TEST(shared_uri_test, copies_share_the_string) {
+  network::shared_uri instance(full_uri);
+  {
+    auto copy = instance;
+    EXPECT_EQ(2u, instance.use_count());
+    EXPECT_EQ(instance.view().data(), copy.view().data());
+    EXPECT_EQ("www.example.com", copy.host());
+  }
+  EXPECT_EQ(1u, instance.use_count());
+}
+
+TEST(shared_uri_test, move) {
+  network::shared_uri instance(full_uri);
+  auto moved = std::move(instance);
+  EXPECT_EQ(1u, moved.use_count());
+  EXPECT_EQ(full_uri, moved.view());
+  EXPECT_TRUE(instance.empty());
+  EXPECT_FALSE(instance.has_host());
+}
+
+TEST(shared_uri_test, assignment) {
+  network::shared_uri first(full_uri), second("http://a.example.com/");
+  first = second;
+  EXPECT_EQ(2u, second.use_count());
+  EXPECT_EQ("a.example.com", first.host());
+  second = network::shared_uri();
+  EXPECT_EQ(1u, first.use_count());
+}
+
+TEST(shared_uri_test, swap) {
+  network::shared_uri first(full_uri), second("http://a.example.com/");
+  swap(first, second);
+  EXPECT_EQ("a.example.com", first.host());
+  EXPECT_EQ(full_uri, second.view());
+}
+
+TEST(shared_uri_test, local_shared_uri) {
+  network::local_shared_uri instance(full_uri);
+  auto copy = instance;
+  EXPECT_EQ(2u, copy.use_count());
+  EXPECT_EQ(instance, copy);
+  EXPECT_EQ("www.example.com", copy.host());
+}
+
+TEST(shared_uri_test, copies_on_different_threads) {
+  network::shared_uri instance(full_uri);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([instance]() {
+      for (int j = 0; j < 10000; ++j) {
+        network::shared_uri copy(instance);
+        ASSERT_EQ("www.example.com", copy.host());
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(1u, instance.use_count());
+}
+
+TEST(shared_uri_test, sort) {
+  std::vector<network::shared_uri> uris;
+  uris.emplace_back("http://c.example.com/");
+  uris.emplace_back("http://b.example.com/");
+  uris.emplace_back("http://a.example.com/");
+  std::sort(std::begin(uris), std::end(uris));
+  EXPECT_EQ("a.example.com", uris[0].host());
+  EXPECT_EQ("c.example.com", uris[2].host());
+}
+
+TEST(shared_uri_test, normalize_and_compare) {
+  network::shared_uri instance("HTTP://www.example.com/a/./b/../c/%7euser");
+  auto normalized =
+      instance.normalize(network::uri_comparison_level::syntax_based);
+  EXPECT_EQ("http://www.example.com/a/c/~user", normalized.view());
+  EXPECT_EQ(0, instance.compare(normalized,
+                                network::uri_comparison_level::syntax_based));
+  EXPECT_NE(0,
+            instance.compare(normalized,
+                             network::uri_comparison_level::string_comparison));
+}
+
+TEST(shared_uri_test, resolve_and_make_relative) {
+  network::shared_uri base("http://a/b/c/d;p?q");
+  network::shared_uri reference(network::uri_builder().path("../g").uri());
+  auto resolved = reference.resolve(base);
+  EXPECT_EQ("http://a/b/g", resolved.view());
+  EXPECT_EQ("/b/g",
+            network::shared_uri("http://a/").make_relative(resolved).view());
+}
+
+TEST(shared_uri_test, hash_is_the_same_as_the_uri) {
+  network::shared_uri instance(full_uri);
+  EXPECT_EQ(network::uri(full_uri).hash(), instance.hash());
+  EXPECT_EQ(instance.hash(), std::hash<network::shared_uri>()(instance));
+  EXPECT_EQ(network::uri().hash(), network::shared_uri().hash());
+}
@@ -0,0 +1,186 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <network/uri.hpp>
+#include "string_utility.hpp"
+
+namespace {
+typedef network::small_uri<64> small_uri;
+
+const char short_uri[] = "http://user@www.example.com:8080/path?query#fragment";
+
+// longer than the inline capacity
+const char long_uri[] =
+    "http://www.example.com/a/long/path/to/a/resource/that/does/not/fit"
+    "?query=value#fragment";
+}  // namespace
+
+TEST(small_uri_test, layout) {
+  EXPECT_EQ(128u + 64u, sizeof(network::small_uri<128>));
+  EXPECT_EQ(64u + 64u, sizeof(small_uri));
+}
+
+TEST(small_uri_test, default_constructed_small_uri_is_empty) {
+  small_uri instance;
+  EXPECT_TRUE(instance.empty());
+  EXPECT_TRUE(instance.is_inline());
+  EXPECT_FALSE(instance.has_scheme());
+}
+
+TEST(small_uri_test, short_uri_is_inline) {
+  small_uri instance(short_uri);
+  EXPECT_TRUE(instance.is_inline());
+  EXPECT_LE(static_cast<const void *>(&instance),
+            static_cast<const void *>(instance.view().data()));
+  EXPECT_GT(static_cast<const void *>(&instance + 1),
+            static_cast<const void *>(instance.view().data()));
+  EXPECT_EQ("http", instance.scheme());
+  EXPECT_EQ("user", instance.user_info());
+  EXPECT_EQ("www.example.com", instance.host());
+  EXPECT_EQ("8080", instance.port());
+  EXPECT_EQ(8080, instance.port<int>());
+  EXPECT_EQ("/path", instance.path());
+  EXPECT_EQ("query", instance.query());
+  EXPECT_EQ("fragment", instance.fragment());
+  EXPECT_EQ("user@www.example.com:8080", instance.authority());
+}
+
+TEST(small_uri_test, long_uri_is_on_the_heap) {
+  small_uri instance(long_uri);
+  EXPECT_FALSE(instance.is_inline());
+  EXPECT_EQ(long_uri, instance.view());
+  EXPECT_EQ("www.example.com", instance.host());
+  EXPECT_EQ("query=value", instance.query());
+}
+
+TEST(small_uri_test, uri_at_the_inline_capacity) {
+  std::string source("http://www.example.com/");
+  source.append(64 - source.size(), 'a');
+  small_uri instance(source);
+  EXPECT_TRUE(instance.is_inline());
+  source.append("a");
+  EXPECT_FALSE(small_uri(source).is_inline());
+}
+
+TEST(small_uri_test, whitespace_is_ignored) {
+  small_uri instance("  http://www.example.com/  ");
+  EXPECT_EQ("http://www.example.com/", instance.view());
+  EXPECT_TRUE(small_uri("   ").empty());
+}
+
+TEST(small_uri_test, construct_invalid_small_uri) {
+  EXPECT_THROW(small_uri("I am not a valid URI."), network::uri_syntax_error);
+}
+
+TEST(small_uri_test, construct_invalid_small_uri_with_error_code) {
+  std::error_code ec;
+  small_uri instance("I am not a valid URI.", ec);
+  EXPECT_EQ(network::make_error_code(network::uri_error::invalid_syntax), ec);
+}
+
+TEST(small_uri_test, construct_from_uri_and_uri_view) {
+  network::uri original(long_uri);
+  small_uri from_uri(original);
+  network::uri_view view(short_uri);
+  small_uri from_view(view);
+  EXPECT_EQ(original.view(), from_uri.view());
+  EXPECT_EQ(original.query(), from_uri.query());
+  EXPECT_EQ(view.host(), from_view.host());
+  EXPECT_EQ(from_view.as_view(), view);
+}
+
+TEST(small_uri_test, copy) {
+  for (auto source : {short_uri, long_uri}) {
+    small_uri instance(source);
+    small_uri copy(instance);
+    EXPECT_EQ(instance, copy);
+    EXPECT_NE(instance.view().data(), copy.view().data());
+    EXPECT_EQ("www.example.com", copy.host());
+  }
+}
+
+TEST(small_uri_test, move) {
+  for (auto source : {short_uri, long_uri}) {
+    small_uri instance(source);
+    small_uri moved(std::move(instance));
+    EXPECT_EQ(source, moved.view());
+    EXPECT_EQ("www.example.com", moved.host());
+    EXPECT_TRUE(instance.empty());
+    EXPECT_FALSE(instance.has_host());
+  }
+}
+
+TEST(small_uri_test, assignment) {
+  small_uri first(short_uri), second(long_uri);
+  first = second;
+  EXPECT_EQ(long_uri, first.view());
+  second = small_uri(short_uri);
+  EXPECT_EQ(short_uri, second.view());
+  const small_uri &alias = first;
+  first = alias;
+  EXPECT_EQ(long_uri, first.view());
+}
+
+TEST(small_uri_test, swap) {
+  small_uri first(short_uri), second(long_uri);
+  swap(first, second);
+  EXPECT_EQ(long_uri, first.view());
+  EXPECT_FALSE(first.is_inline());
+  EXPECT_EQ(short_uri, second.view());
+  EXPECT_TRUE(second.is_inline());
+}
+
+TEST(small_uri_test, sort) {
+  std::vector<small_uri> uris;
+  uris.emplace_back("http://c.example.com/");
+  uris.emplace_back(long_uri);
+  uris.emplace_back("http://a.example.com/");
+  std::sort(std::begin(uris), std::end(uris));
+  EXPECT_EQ("a.example.com", uris[0].host());
+  EXPECT_EQ("c.example.com", uris[1].host());
+  EXPECT_EQ(long_uri, uris[2].view());
+}
+
+TEST(small_uri_test, query_iterator) {
+  small_uri instance("http://example.com/?a=1&b=2");
+  auto it = instance.query_begin();
+  ASSERT_NE(instance.query_end(), it);
+  EXPECT_EQ("a", it->first);
+  ++it;
+  ASSERT_NE(instance.query_end(), it);
+  EXPECT_EQ("b", it->first);
+  ++it;
+  EXPECT_EQ(instance.query_end(), it);
+}
+
+TEST(small_uri_test, normalize_and_compare) {
+  small_uri instance("HTTP://www.example.com/a/./b/../c/%7euser");
+  auto normalized =
+      instance.normalize(network::uri_comparison_level::syntax_based);
+  EXPECT_EQ("http://www.example.com/a/c/~user", normalized.view());
+  EXPECT_EQ(0, instance.compare(normalized,
+                                network::uri_comparison_level::syntax_based));
+  EXPECT_NE(0,
+            instance.compare(normalized,
+                             network::uri_comparison_level::string_comparison));
+}
+
+TEST(small_uri_test, resolve_and_make_relative) {
+  small_uri base("http://a/b/c/d;p?q");
+  small_uri reference(network::uri_builder().path("../g").uri());
+  auto resolved = reference.resolve(base);
+  EXPECT_EQ("http://a/b/g", resolved.view());
+  EXPECT_EQ("/b/g", small_uri("http://a/").make_relative(resolved).view());
+}
+
+TEST(small_uri_test, hash_is_the_same_as_the_uri) {
+  network::small_uri<> instance("http://www.example.com/");
+  EXPECT_EQ(network::uri("http://www.example.com/").hash(),
+            std::hash<network::small_uri<>>()(instance));
+}
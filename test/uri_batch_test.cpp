@@ -0,0 +1,149 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <fstream>
+#include <sstream>
+#include <gtest/gtest.h>
+#include <network/uri.hpp>
+#include "string_utility.hpp"
+
+namespace {
+typedef network::uri_batch::component_type component;
+
+std::string read_file(const std::string &filename) {
+  std::ifstream ifs(filename);
+  if (!ifs) {
+    throw std::runtime_error("Unable to open file: " + filename);
+  }
+  std::ostringstream oss;
+  oss << ifs.rdbuf();
+  return oss.str();
+}
+}  // namespace
+
+TEST(uri_batch_test, empty_buffer) {
+  auto batch = network::parse_batch("");
+  EXPECT_TRUE(batch.empty());
+  EXPECT_EQ(0u, batch.size());
+}
+
+TEST(uri_batch_test, single_line_without_newline) {
+  auto batch = network::parse_batch("http://www.example.com/");
+  ASSERT_EQ(1u, batch.size());
+  EXPECT_TRUE(batch.is_valid(0));
+  EXPECT_EQ("www.example.com", batch.component(0, component::host));
+}
+
+TEST(uri_batch_test, trailing_newline_is_not_a_line) {
+  auto batch = network::parse_batch("http://a.com/\nhttp://b.com/\n");
+  EXPECT_EQ(2u, batch.size());
+}
+
+TEST(uri_batch_test, components) {
+  std::string buffer(
+      "http://user@www.example.com:80/path?query#fragment\n"
+      "mailto:john.doe@example.com\n");
+  auto batch = network::parse_batch(buffer);
+  ASSERT_EQ(2u, batch.size());
+
+  ASSERT_TRUE(batch.is_valid(0));
+  EXPECT_EQ("http", batch.component(0, component::scheme));
+  EXPECT_EQ("user", batch.component(0, component::user_info));
+  EXPECT_EQ("www.example.com", batch.component(0, component::host));
+  EXPECT_EQ("80", batch.component(0, component::port));
+  EXPECT_EQ("/path", batch.component(0, component::path));
+  EXPECT_EQ("query", batch.component(0, component::query));
+  EXPECT_EQ("fragment", batch.component(0, component::fragment));
+
+  ASSERT_TRUE(batch.is_valid(1));
+  EXPECT_EQ("mailto", batch.component(1, component::scheme));
+  EXPECT_FALSE(batch.has(1, component::host));
+  EXPECT_EQ(network::uri_batch::npos, batch.first(component::host)[1]);
+  EXPECT_EQ("john.doe@example.com", batch.component(1, component::path));
+}
+
+TEST(uri_batch_test, components_refer_to_the_buffer) {
+  std::string buffer("http://a.com/\nhttp://www.example.com/path\n");
+  auto batch = network::parse_batch(buffer);
+  ASSERT_EQ(2u, batch.size());
+  EXPECT_EQ(14u, batch.line_offsets()[1]);
+  EXPECT_EQ(buffer.data() + 21, batch.component(1, component::host).data());
+}
+
+TEST(uri_batch_test, invalid_and_blank_lines) {
+  auto batch = network::parse_batch(
+      "http://a.com/\n"
+      "I am not a valid URI.\n"
+      "\n"
+      "http://b.com/\n");
+  ASSERT_EQ(4u, batch.size());
+  EXPECT_TRUE(batch.is_valid(0));
+  EXPECT_FALSE(batch.error(0));
+  EXPECT_FALSE(batch.is_valid(1));
+  EXPECT_EQ(network::make_error_code(network::uri_error::invalid_scheme),
+            batch.error(1));
+  EXPECT_FALSE(batch.is_valid(2));
+  EXPECT_EQ(network::uri_error::empty_uri, batch.errors()[2]);
+  EXPECT_TRUE(batch.is_valid(3));
+  EXPECT_EQ(0x9u, batch.valid_bits()[0]);
+}
+
+TEST(uri_batch_test, whitespace_and_crlf) {
+  auto batch = network::parse_batch("  http://a.com/  \r\nhttp://b.com/\r\n");
+  ASSERT_EQ(2u, batch.size());
+  EXPECT_EQ("http://a.com/", batch.line(0));
+  EXPECT_EQ("a.com", batch.component(0, component::host));
+  EXPECT_EQ("http://b.com/", batch.line(1));
+  EXPECT_TRUE(batch.is_valid(1));
+}
+
+TEST(uri_batch_test, port_at_the_end_of_a_line) {
+  auto batch = network::parse_batch("http://a.com:80\n99999");
+  ASSERT_EQ(2u, batch.size());
+  ASSERT_TRUE(batch.is_valid(0));
+  EXPECT_EQ("80", batch.component(0, component::port));
+}
+
+TEST(uri_batch_test, same_as_uri) {
+  auto buffer = read_file("valid_urls.txt") + read_file("invalid_urls.txt");
+  auto batch = network::parse_batch(buffer);
+  ASSERT_LT(0u, batch.size());
+
+  for (std::size_t i = 0; i < batch.size(); ++i) {
+    std::error_code ec;
+    network::uri_view instance(batch.line(i), ec);
+    ASSERT_EQ(!ec && !instance.empty(), batch.is_valid(i)) << batch.line(i);
+    EXPECT_EQ(network::parse_uri(batch.line(i)).error(), batch.errors()[i]);
+    if (batch.is_valid(i)) {
+      EXPECT_EQ(instance.scheme(), batch.component(i, component::scheme));
+      EXPECT_EQ(instance.has_host(), batch.has(i, component::host));
+      EXPECT_EQ(instance.host(), batch.component(i, component::host));
+      EXPECT_EQ(instance.has_port(), batch.has(i, component::port));
+      EXPECT_EQ(instance.path(), batch.component(i, component::path));
+      EXPECT_EQ(instance.has_query(), batch.has(i, component::query));
+      EXPECT_EQ(instance.query(), batch.component(i, component::query));
+      EXPECT_EQ(instance.fragment(), batch.component(i, component::fragment));
+    }
+  }
+}
+
+TEST(uri_batch_test, threads) {
+  std::string buffer;
+  for (std::size_t i = 0; i < 1000; ++i) {
+    buffer += (i % 7 == 0) ? "not a uri\n"
+                           : "http://www.example.com/" + std::to_string(i) +
+                                 "\n";
+  }
+
+  auto expected = network::parse_batch(buffer);
+  for (unsigned threads : {0u, 2u, 3u, 8u, 64u}) {
+    auto batch = network::parse_batch(buffer, threads);
+    ASSERT_EQ(expected.size(), batch.size());
+    EXPECT_EQ(expected.valid_bits(), batch.valid_bits());
+    EXPECT_EQ(expected.errors(), batch.errors());
+    EXPECT_EQ(expected.first(component::path), batch.first(component::path));
+    EXPECT_EQ(expected.last(component::path), batch.last(component::path));
+  }
+}
@@ -0,0 +1,195 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <fstream>
+#include <vector>
+#include <gtest/gtest.h>
+#include <network/uri/uri_incremental_parser.hpp>
+#include "test_uri.hpp"
+
+namespace {
+using network::detail::uri_component;
+
+const uri_component components[] = {
+    uri_component::scheme, uri_component::user_info, uri_component::host,
+    uri_component::port,   uri_component::path,      uri_component::query,
+    uri_component::fragment};
+
+typedef network::detail::compact_uri_parts::offset_type offset_type;
+
+struct recorder {
+  void operator()(uri_component c, std::size_t first, std::size_t last) {
+    EXPECT_FALSE(parts.has(c));
+    parts.set(c, static_cast<offset_type>(first),
+              static_cast<offset_type>(last));
+  }
+
+  network::detail::compact_uri_parts parts;
+};
+
+bool parse_in_chunks(const std::string &uri, std::size_t chunk_size,
+                     network::detail::compact_uri_parts &parts) {
+  network::uri_incremental_parser parser;
+  recorder handler;
+  network::string_view view(uri);
+  for (std::size_t i = 0; i < view.size(); i += chunk_size) {
+    parser.feed(view.substr(i, chunk_size), handler);
+  }
+  bool is_valid = parser.finish(handler);
+  parts = handler.parts;
+  return is_valid;
+}
+
+void expect_same_as_parse(const std::string &uri) {
+  test::uri expected(uri);
+  bool expected_is_valid = expected.parse_uri();
+  network::detail::compact_uri_parts expected_parts(std::begin(expected.view),
+                                                    expected.parts);
+
+  for (std::size_t chunk_size = 1; chunk_size <= uri.size() + 1;
+       ++chunk_size) {
+    network::detail::compact_uri_parts parts;
+    ASSERT_EQ(expected_is_valid, parse_in_chunks(uri, chunk_size, parts))
+        << uri << " in chunks of " << chunk_size;
+    if (!expected_is_valid) {
+      continue;
+    }
+
+    for (auto c : components) {
+      ASSERT_EQ(expected_parts.has(c), parts.has(c)) << uri;
+      if (parts.has(c)) {
+        EXPECT_EQ(expected_parts.first(c), parts.first(c)) << uri;
+        EXPECT_EQ(expected_parts.last(c), parts.last(c)) << uri;
+      }
+    }
+  }
+}
+
+std::vector<std::string> create_urls(const std::string &filename) {
+  std::vector<std::string> urls;
+  std::ifstream ifs(filename);
+  if (!ifs) {
+    throw std::runtime_error("Unable to open file: " + filename);
+  }
+  for (std::string url; std::getline(ifs, url);) {
+    if (url.front() != '#') {
+      urls.push_back(url);
+    }
+  }
+  return urls;
+}
+}  // namespace
+
+TEST(uri_incremental_parser_test, empty_uri) {
+  network::uri_incremental_parser parser;
+  recorder handler;
+  EXPECT_FALSE(parser.finish(handler));
+}
+
+TEST(uri_incremental_parser_test, components_are_reported_when_they_end) {
+  network::uri_incremental_parser parser;
+  recorder handler;
+  ASSERT_TRUE(parser.feed("http://www.exam", handler));
+  EXPECT_TRUE(handler.parts.has(uri_component::scheme));
+  EXPECT_FALSE(handler.parts.has(uri_component::host));
+
+  ASSERT_TRUE(parser.feed("ple.com/path?qu", handler));
+  ASSERT_TRUE(handler.parts.has(uri_component::host));
+  EXPECT_EQ(7u, handler.parts.first(uri_component::host));
+  EXPECT_EQ(22u, handler.parts.last(uri_component::host));
+  ASSERT_TRUE(handler.parts.has(uri_component::path));
+  EXPECT_EQ(22u, handler.parts.first(uri_component::path));
+  EXPECT_EQ(27u, handler.parts.last(uri_component::path));
+  EXPECT_FALSE(handler.parts.has(uri_component::query));
+
+  ASSERT_TRUE(parser.finish(handler));
+  ASSERT_TRUE(handler.parts.has(uri_component::query));
+  EXPECT_EQ(28u, handler.parts.first(uri_component::query));
+  EXPECT_EQ(30u, handler.parts.last(uri_component::query));
+  EXPECT_EQ(30u, parser.size());
+}
+
+TEST(uri_incremental_parser_test, invalid_uri_fails_early) {
+  network::uri_incremental_parser parser;
+  recorder handler;
+  EXPECT_FALSE(parser.feed("http://www.example.com/ pa", handler));
+  EXPECT_TRUE(parser.failed());
+  EXPECT_FALSE(parser.feed("th", handler));
+  EXPECT_FALSE(parser.finish(handler));
+}
+
+TEST(uri_incremental_parser_test, incomplete_pct_encoded_at_the_end) {
+  network::uri_incremental_parser parser;
+  recorder handler;
+  EXPECT_TRUE(parser.feed("http://www.example.com/%4", handler));
+  EXPECT_FALSE(parser.finish(handler));
+}
+
+TEST(uri_incremental_parser_test, reset) {
+  network::uri_incremental_parser parser;
+  recorder handler;
+  EXPECT_FALSE(parser.feed("http://www.example.com/ ", handler));
+  parser.reset();
+  recorder other_handler;
+  EXPECT_TRUE(parser.feed("mailto:john.doe@example.com", other_handler));
+  EXPECT_TRUE(parser.finish(other_handler));
+  EXPECT_TRUE(other_handler.parts.has(uri_component::path));
+}
+
+class test_incremental_urls : public ::testing::TestWithParam<std::string> {};
+
+INSTANTIATE_TEST_CASE_P(
+    uri_incremental_parser_test, test_incremental_urls,
+    testing::Values(
+        "http://user@www.example.com:80/path?query#fragment",
+        "http://www.example.com", "http://www.example.com:80",
+        "http://www.example.com:/", "http://www.example.com:", "http://:80/",
+        "http://user@:80/", "http://@www.example.com/", "http://user@",
+        "http://user@www.example.com", "http://user@www.example.com:8080",
+        "http://user@www.example.com:80?query",
+        "http://u:p@www.example.com:80/", "http://u%41@www.example.com/",
+        "http://u%4@www.example.com/", "http://u%zz@www.example.com/",
+        "http://www.example.com: 80/", "http://www.example.com:+80/",
+        "http://www.example.com:-1/", "http://www.example.com:-0/",
+        "http://www.example.com:12ab/", "http://www.example.com:65535/",
+        "http://www.example.com:65534",
+        "http://www.example.com:99999999999999999999/",
+        "http://www.example.com?query", "http://www.example.com#fragment",
+        "http://[::1]", "http://[::1]:8080/path", "http://[::1]/path",
+        "http://[::1]?query", "http://[::1]#fragment", "http://[::1]abc",
+        "http://[::1", "http://user@[::1]:80/", "http://ab[::1]/",
+        "http://[::1]]:80/", "mailto:john.doe@example.com", "a:", "a:/",
+        "a:?", "a:/?", "a:%", "a:/%zz", "a:b%", "a:b%4", "a:b%41",
+        "a:b?%", "a:b?%4", "a:b?%41#%", "a:b#%4", "a:b#%41", "a:b#c#d",
+        "a:b?c?d", "file:///path/to/file.txt", "file://", "file:///",
+        "1http://example.com/", "ht tp://example.com/", "http",
+        "http://example.com/pa th", "http://example.com/?que ry",
+        "http://example.com/#frag ment"));
+
+TEST_P(test_incremental_urls, same_as_parse) {
+  expect_same_as_parse(GetParam());
+}
+
+class test_incremental_valid_urls
+    : public ::testing::TestWithParam<std::string> {};
+
+INSTANTIATE_TEST_CASE_P(uri_incremental_parser_test,
+                        test_incremental_valid_urls,
+                        testing::ValuesIn(create_urls("valid_urls.txt")));
+
+TEST_P(test_incremental_valid_urls, same_as_parse) {
+  expect_same_as_parse(GetParam());
+}
+
+class test_incremental_invalid_urls
+    : public ::testing::TestWithParam<std::string> {};
+
+INSTANTIATE_TEST_CASE_P(uri_incremental_parser_test,
+                        test_incremental_invalid_urls,
+                        testing::ValuesIn(create_urls("invalid_urls.txt")));
+
+TEST_P(test_incremental_invalid_urls, same_as_parse) {
+  expect_same_as_parse(GetParam());
+}
@@ -0,0 +1,128 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <fstream>
+#include <gtest/gtest.h>
+#include <network/uri.hpp>
+#include "string_utility.hpp"
+
+namespace {
+void expect_error(network::uri_error error, std::size_t position,
+                  const std::string &source) {
+  auto result = network::parse_uri(source);
+  EXPECT_FALSE(result) << source;
+  EXPECT_EQ(error, result.error()) << source;
+  EXPECT_EQ(position, result.position()) << source;
+  EXPECT_TRUE(result.view().empty()) << source;
+}
+}  // namespace
+
+TEST(uri_parse_result_test, valid_uri) {
+  std::string source("http://www.example.com/path?query#fragment");
+  auto result = network::parse_uri(source);
+  ASSERT_TRUE(result);
+  EXPECT_EQ(network::uri_error(), result.error());
+  EXPECT_EQ(source.size(), result.position());
+  EXPECT_EQ("www.example.com", result.view().host());
+  EXPECT_EQ(source.data(), result.view().view().data());
+}
+
+TEST(uri_parse_result_test, whitespace_is_ignored) {
+  auto result = network::parse_uri("  http://a.com/  ");
+  ASSERT_TRUE(result);
+  EXPECT_EQ("http://a.com/", result.view().view());
+  EXPECT_EQ(15u, result.position());
+}
+
+TEST(uri_parse_result_test, default_constructor) {
+  network::parse_result result;
+  EXPECT_FALSE(result);
+  EXPECT_EQ(network::uri_error::empty_uri, result.error());
+}
+
+TEST(uri_parse_result_test, empty_uri) {
+  expect_error(network::uri_error::empty_uri, 0, "");
+  EXPECT_EQ(network::uri_error::empty_uri, network::parse_uri("  ").error());
+}
+
+TEST(uri_parse_result_test, invalid_scheme) {
+  expect_error(network::uri_error::invalid_scheme, 0, "1http://a.com/");
+  expect_error(network::uri_error::invalid_scheme, 2, "ht tp://a.com/");
+  expect_error(network::uri_error::invalid_scheme, 4, "http");
+}
+
+TEST(uri_parse_result_test, invalid_user_info) {
+  expect_error(network::uri_error::invalid_user_info, 7, "http://@a.com/");
+  expect_error(network::uri_error::invalid_user_info, 9,
+               "http://us er@a.com/");
+}
+
+TEST(uri_parse_result_test, invalid_host) {
+  expect_error(network::uri_error::invalid_host, 7, "http://");
+  expect_error(network::uri_error::invalid_host, 7, "http://:80/");
+  expect_error(network::uri_error::invalid_host, 12, "http://user@:80/");
+  expect_error(network::uri_error::invalid_host, 12, "http://user@");
+}
+
+TEST(uri_parse_result_test, invalid_port) {
+  expect_error(network::uri_error::invalid_port, 23,
+               "http://www.example.com:99999/");
+  expect_error(network::uri_error::invalid_port, 23,
+               "http://www.example.com:99999");
+  expect_error(network::uri_error::invalid_port, 14, "http://[::1]:8a/");
+  expect_error(network::uri_error::invalid_port, 13, "http://[::1]:99999");
+}
+
+TEST(uri_parse_result_test, invalid_path) {
+  expect_error(network::uri_error::invalid_path, 15, "http://a.com/pa th");
+}
+
+TEST(uri_parse_result_test, invalid_query) {
+  expect_error(network::uri_error::invalid_query, 17,
+               "http://a.com/?que ry");
+}
+
+TEST(uri_parse_result_test, invalid_fragment) {
+  expect_error(network::uri_error::invalid_fragment, 18,
+               "http://a.com/#frag ment");
+}
+
+TEST(uri_parse_result_test, invalid_pct_encoded) {
+  expect_error(network::uri_error::invalid_pct_encoded, 8,
+               "http://u%zz@a.com/");
+  expect_error(network::uri_error::invalid_pct_encoded, 13,
+               "http://a.com/%zz");
+  expect_error(network::uri_error::invalid_pct_encoded, 13, "http://a.com/%4");
+  expect_error(network::uri_error::invalid_pct_encoded, 16,
+               "http://a.com/?a=%zz");
+  expect_error(network::uri_error::invalid_pct_encoded, 14,
+               "http://a.com/#%g0");
+}
+
+TEST(uri_parse_result_test, error_message) {
+  EXPECT_EQ("Invalid port.",
+            network::make_error_code(network::uri_error::invalid_port)
+                .message());
+  EXPECT_EQ("Invalid percent encoded character.",
+            network::make_error_code(network::uri_error::invalid_pct_encoded)
+                .message());
+}
+
+TEST(uri_parse_result_test, same_as_uri_view) {
+  for (auto filename : {"valid_urls.txt", "invalid_urls.txt"}) {
+    std::ifstream ifs(filename);
+    ASSERT_TRUE(ifs) << filename;
+    for (std::string line; std::getline(ifs, line);) {
+      std::error_code ec;
+      network::uri_view instance(line, ec);
+      auto result = network::parse_uri(line);
+      EXPECT_EQ(!ec && !instance.empty(), static_cast<bool>(result)) << line;
+      EXPECT_LE(result.position(), line.size()) << line;
+      if (result) {
+        EXPECT_EQ(instance, result.view()) << line;
+      }
+    }
+  }
+}
@@ -537,6 +537,91 @@ TEST(uri_parse_test, test_has_host_bug_88) {
   EXPECT_TRUE(uri.parse_uri());
 }
 
+TEST(uri_parse_test, test_long_path_query_and_fragment) {
+  const std::string path = "/" + std::string(100, 'a') + "/b;c=d/e:f@g~h";
+  const std::string query = std::string(70, 'q') + "=v&x=%2F?y/z";
+  const std::string fragment = std::string(40, 'f') + "?/%3A";
+  test::uri uri("http://www.example.com" + path + "?" + query + "#" + fragment);
+  EXPECT_TRUE(uri.parse_uri());
+  ASSERT_TRUE(uri.has_path());
+  EXPECT_EQ(path, uri.path());
+  ASSERT_TRUE(uri.has_query());
+  EXPECT_EQ(query, uri.query());
+  ASSERT_TRUE(uri.has_fragment());
+  EXPECT_EQ(fragment, uri.fragment());
+}
+
+// The remaining tests move a character through every position of a
+// long component, so that it is found at each offset in a block as
+// well as in the trailing characters.
+TEST(uri_parse_test, test_delimiter_at_every_position_in_a_long_path) {
+  for (std::size_t i = 1; i < 80; ++i) {
+    std::string path = "/" + std::string(80, 'a');
+    path[i] = '?';
+    test::uri uri("http://www.example.com" + path);
+    EXPECT_TRUE(uri.parse_uri());
+    ASSERT_TRUE(uri.has_path());
+    EXPECT_EQ(path.substr(0, i), uri.path());
+    ASSERT_TRUE(uri.has_query());
+    EXPECT_EQ(path.substr(i + 1), uri.query());
+  }
+}
+
+TEST(uri_parse_test, test_invalid_character_at_every_position_in_a_long_path) {
+  for (std::size_t i = 1; i < 80; ++i) {
+    for (char c : {'<', '"', ' ', '\x7f', '\xe2'}) {
+      std::string path = "/" + std::string(80, 'a');
+      path[i] = c;
+      test::uri uri("http://www.example.com" + path);
+      EXPECT_FALSE(uri.parse_uri()) << path;
+    }
+  }
+}
+
+TEST(uri_parse_test, test_pct_encoded_at_every_position_in_a_long_path) {
+  for (std::size_t i = 1; i < 80; ++i) {
+    std::string path = "/" + std::string(80, 'a');
+    path.replace(i, 3, "%2f");
+    test::uri uri("http://www.example.com" + path);
+    EXPECT_TRUE(uri.parse_uri()) << path;
+    ASSERT_TRUE(uri.has_path());
+    EXPECT_EQ(path, uri.path());
+  }
+}
+
+TEST(uri_parse_test, test_invalid_character_at_every_position_in_a_long_query) {
+  for (std::size_t i = 0; i < 80; ++i) {
+    for (char c : {'[', '`', '{', '\xe2'}) {
+      std::string query(80, 'q');
+      query[i] = c;
+      test::uri uri("http://www.example.com/?" + query);
+      EXPECT_FALSE(uri.parse_uri()) << query;
+    }
+  }
+}
+
+TEST(uri_parse_test, test_fragment_at_every_position_in_a_long_query) {
+  for (std::size_t i = 0; i < 80; ++i) {
+    std::string query(80, 'q');
+    query[i] = '#';
+    test::uri uri("http://www.example.com/?" + query);
+    EXPECT_TRUE(uri.parse_uri());
+    ASSERT_TRUE(uri.has_query());
+    EXPECT_EQ(query.substr(0, i), uri.query());
+    ASSERT_TRUE(uri.has_fragment());
+    EXPECT_EQ(query.substr(i + 1), uri.fragment());
+  }
+}
+
+TEST(uri_parse_test, test_invalid_character_at_every_position_in_a_long_fragment) {
+  for (std::size_t i = 0; i < 80; ++i) {
+    std::string fragment(80, 'f');
+    fragment[i] = '#';
+    test::uri uri("http://www.example.com/#" + fragment);
+    EXPECT_FALSE(uri.parse_uri()) << fragment;
+  }
+}
+
 // http://formvalidation.io/validators/uri/
 
 std::vector<std::string> create_urls(const std::string &filename) {
@@ -563,3 +648,70 @@ TEST_P(test_valid_urls, urls_are_valid) {
   test::uri uri(GetParam());
   EXPECT_TRUE(uri.parse_uri());
 }
+
+// The fast path for web URIs gives the same result as the generic parser
+void expect_same_as_generic(const std::string &uri) {
+  network::string_view view(uri);
+  auto it = std::begin(view), generic_it = std::begin(view);
+  auto last = std::end(view);
+  uri_parts parts, generic_parts;
+  network::uri_error error{}, generic_error{};
+  bool is_valid = parse(it, last, parts, error);
+  ASSERT_EQ(network::detail::parse_generic(generic_it, last, generic_parts,
+                                           generic_error),
+            is_valid)
+      << uri;
+  EXPECT_EQ(generic_error, error) << uri;
+  EXPECT_EQ(generic_it, it) << uri;
+  if (!is_valid) {
+    return;
+  }
+
+  network::detail::compact_uri_parts compact(std::begin(view), parts),
+      generic_compact(std::begin(view), generic_parts);
+  for (unsigned char c = 0;
+       c < network::detail::compact_uri_parts::component_count; ++c) {
+    auto component = static_cast<network::detail::uri_component>(c);
+    ASSERT_EQ(generic_compact.has(component), compact.has(component)) << uri;
+    if (compact.has(component)) {
+      EXPECT_EQ(generic_compact.first(component), compact.first(component))
+          << uri;
+      EXPECT_EQ(generic_compact.last(component), compact.last(component))
+          << uri;
+    }
+  }
+}
+
+class test_web_urls : public ::testing::TestWithParam<std::string> {};
+
+INSTANTIATE_TEST_CASE_P(
+    uri_parse_test, test_web_urls,
+    testing::Values(
+        "http://www.example.com/", "https://www.example.com/",
+        "ws://www.example.com/", "wss://www.example.com/", "ws://a.b",
+        "http://a", "http://", "http:///path", "http://www.example.com",
+        "http://www.example.com:80", "http://www.example.com:80/path",
+        "http://www.example.com:/path", "http://www.example.com:",
+        "http://www.example.com:65534/", "http://www.example.com:65535/",
+        "http://www.example.com:99999/", "http://www.example.com:080/",
+        "http://www.example.com:123456/", "http://www.example.com:8a/",
+        "http://www.example.com:80:90/", "http://a:b:80/", "http://:80/",
+        "http://user@www.example.com/", "http://[::1]:8080/",
+        "http://www.exa mple.com/", "http://www.ex%41mple.com/",
+        "http://www.example.com?query", "http://www.example.com#fragment",
+        "http://www.example.com/?query#fragment",
+        "http://www.example.com/pa th", "http://www.example.com/%zz",
+        "http://www.example.com/?que ry", "http://www.example.com/#frag ment",
+        "http://www.example.com/#a#b", "http://www.example.com/?a?b#c?d",
+        "HTTP://www.example.com/", "httpx://www.example.com/",
+        "http:/www.example.com/", "https:www.example.com"));
+
+TEST_P(test_web_urls, same_as_generic) { expect_same_as_generic(GetParam()); }
+
+TEST(uri_parse_test, url_lists_are_parsed_the_same_as_generic) {
+  for (auto filename : {"valid_urls.txt", "invalid_urls.txt"}) {
+    for (const auto &url : create_urls(filename)) {
+      expect_same_as_generic(url);
+    }
+  }
+}
@@ -0,0 +1,242 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iterator>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <network/uri.hpp>
+#include "string_utility.hpp"
+
+namespace {
+const char full_uri[] = "http://user@www.example.com:8080/path?query#fragment";
+}  // namespace
+
+TEST(uri_pool_test, default_constructed_pool_is_empty) {
+  network::uri_pool pool;
+  EXPECT_TRUE(pool.empty());
+  EXPECT_EQ(0u, pool.size());
+  EXPECT_EQ(network::uri_comparison_level::string_comparison, pool.level());
+  EXPECT_EQ(network::uri_pool::npos, pool.find(full_uri));
+}
+
+TEST(uri_pool_test, insert_returns_a_view_of_the_uri) {
+  network::uri_pool pool;
+  auto handle = pool.insert(full_uri);
+  EXPECT_EQ(0u, handle);
+  auto instance = pool[handle];
+  EXPECT_EQ(full_uri, instance.view());
+  EXPECT_EQ("http", instance.scheme());
+  EXPECT_EQ("user", instance.user_info());
+  EXPECT_EQ("www.example.com", instance.host());
+  EXPECT_EQ("8080", instance.port());
+  EXPECT_EQ("/path", instance.path());
+  EXPECT_EQ("query", instance.query());
+  EXPECT_EQ("fragment", instance.fragment());
+}
+
+TEST(uri_pool_test, the_pool_owns_the_string) {
+  network::uri_pool pool;
+  std::string source(full_uri);
+  auto handle = pool.insert(source);
+  EXPECT_NE(source.data(), pool[handle].view().data());
+  source.assign(source.size(), 'x');
+  EXPECT_EQ(full_uri, pool[handle].view());
+}
+
+TEST(uri_pool_test, equal_uris_have_the_same_handle) {
+  network::uri_pool pool;
+  auto first = pool.insert("http://www.example.com/");
+  auto second = pool.insert("http://www.example.org/");
+  auto third = pool.insert(std::string("http://www.example.com/"));
+  EXPECT_NE(first, second);
+  EXPECT_EQ(first, third);
+  EXPECT_EQ(2u, pool.size());
+  EXPECT_EQ(first, pool.find("http://www.example.com/"));
+  EXPECT_EQ(second, pool.find("  http://www.example.org/ "));
+}
+
+TEST(uri_pool_test, string_comparison_doesnt_normalize) {
+  network::uri_pool pool;
+  auto first = pool.insert("http://www.example.com/");
+  auto second = pool.insert("HTTP://www.example.com/");
+  EXPECT_NE(first, second);
+  EXPECT_EQ("HTTP://www.example.com/", pool[second].view());
+}
+
+TEST(uri_pool_test, syntax_based_pool_keeps_the_normalized_uri) {
+  network::uri_pool pool(network::uri_comparison_level::syntax_based);
+  auto first = pool.insert("HTTP://www.example.com/a/./b/../c/%7efoo");
+  auto second = pool.insert("http://www.example.com/a/c/~foo");
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(1u, pool.size());
+  EXPECT_EQ("http://www.example.com/a/c/~foo", pool[first].view());
+  EXPECT_EQ("/a/c/~foo", pool[first].path());
+  EXPECT_EQ(first, pool.find("http://www.example.com/a/b/../c/~foo"));
+}
+
+TEST(uri_pool_test, handles_agree_with_compare) {
+  const char *sources[] = {
+      "http://www.example.com/",       "HTTP://www.example.com/",
+      "http://www.example.com/./",     "http://www.example.com/%7E",
+      "http://www.example.com/~",      "http://www.example.com/%7e",
+      "http://www.example.com/?query", "http://www.example.com/#fragment",
+  };
+  network::uri_pool pool(network::uri_comparison_level::syntax_based);
+  std::vector<network::uri_pool::handle_type> handles;
+  for (auto source : sources) {
+    handles.push_back(pool.insert(source));
+  }
+
+  for (std::size_t i = 0; i < handles.size(); ++i) {
+    for (std::size_t j = 0; j < handles.size(); ++j) {
+      network::uri lhs(sources[i]), rhs(sources[j]);
+      EXPECT_EQ(
+          lhs.compare(rhs, network::uri_comparison_level::syntax_based) == 0,
+          handles[i] == handles[j])
+          << sources[i] << " " << sources[j];
+    }
+  }
+}
+
+TEST(uri_pool_test, insert_uri_and_uri_view) {
+  network::uri_pool pool;
+  network::uri original(full_uri);
+  network::uri_view view(full_uri);
+  auto first = pool.insert(original);
+  auto second = pool.insert(view);
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(first, pool.find(view));
+}
+
+TEST(uri_pool_test, insert_invalid_uri) {
+  network::uri_pool pool;
+  EXPECT_THROW(pool.insert("I am not a valid URI."),
+               network::uri_syntax_error);
+  EXPECT_TRUE(pool.empty());
+  EXPECT_EQ(network::uri_pool::npos, pool.find("I am not a valid URI."));
+}
+
+TEST(uri_pool_test, insert_invalid_uri_with_error_code) {
+  network::uri_pool pool;
+  std::error_code ec;
+  auto handle = pool.insert("I am not a valid URI.", ec);
+  EXPECT_EQ(network::make_error_code(network::uri_error::invalid_syntax), ec);
+  EXPECT_EQ(network::uri_pool::npos, handle);
+}
+
+TEST(uri_pool_test, insert_empty_uri) {
+  network::uri_pool pool;
+  auto first = pool.insert("");
+  auto second = pool.insert("   ");
+  EXPECT_EQ(first, second);
+  EXPECT_TRUE(pool[first].empty());
+}
+
+TEST(uri_pool_test, views_remain_valid_as_the_pool_grows) {
+  network::uri_pool pool(network::uri_comparison_level::string_comparison,
+                         256);
+  auto handle = pool.insert(full_uri);
+  auto view = pool[handle];
+  for (int i = 0; i < 1000; ++i) {
+    pool.insert("http://www.example.com/" + std::to_string(i));
+  }
+  EXPECT_EQ(1001u, pool.size());
+  EXPECT_EQ(full_uri, view.view());
+  EXPECT_EQ("www.example.com", view.host());
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ("http://www.example.com/" + std::to_string(i),
+              pool[static_cast<network::uri_pool::handle_type>(i + 1)]
+                  .view()
+                  .to_string());
+  }
+}
+
+TEST(uri_pool_test, uri_longer_than_a_slab) {
+  network::uri_pool pool(network::uri_comparison_level::string_comparison, 32);
+  auto first = pool.insert("http://a/");
+  auto second = pool.insert(full_uri);
+  auto third = pool.insert("http://b/");
+  EXPECT_EQ("http://a/", pool[first].view());
+  EXPECT_EQ(full_uri, pool[second].view());
+  EXPECT_EQ("http://b/", pool[third].view());
+  // the short URIs share a slab
+  EXPECT_EQ(pool[first].view().data() + 9, pool[third].view().data());
+}
+
+TEST(uri_pool_test, insert_range) {
+  std::vector<std::string> sources{"http://a/", "http://b/", "http://a/"};
+  network::uri_pool pool;
+  std::vector<network::uri_pool::handle_type> handles;
+  pool.insert(std::begin(sources), std::end(sources),
+              std::back_inserter(handles));
+  ASSERT_EQ(3u, handles.size());
+  EXPECT_EQ(handles[0], handles[2]);
+  EXPECT_NE(handles[0], handles[1]);
+  EXPECT_EQ(2u, pool.size());
+}
+
+TEST(uri_pool_test, insert_batch) {
+  std::string buffer(
+      "http://www.example.com/\n"
+      "not a uri\n"
+      "mailto:john.doe@example.com\n"
+      "http://www.example.com/\n");
+  auto batch = network::parse_batch(buffer);
+  network::uri_pool pool;
+  auto handles = pool.insert(batch);
+  ASSERT_EQ(4u, handles.size());
+  EXPECT_EQ(network::uri_pool::npos, handles[1]);
+  EXPECT_EQ(handles[0], handles[3]);
+  EXPECT_EQ(2u, pool.size());
+  EXPECT_EQ("www.example.com", pool[handles[0]].host());
+  EXPECT_EQ("john.doe@example.com", pool[handles[2]].path());
+  EXPECT_EQ("mailto", pool[handles[2]].scheme());
+}
+
+TEST(uri_pool_test, insert_batch_normalizes) {
+  std::string buffer(
+      "HTTP://www.example.com/a/../b\n"
+      "http://www.example.com/b\n");
+  auto batch = network::parse_batch(buffer);
+  network::uri_pool pool(network::uri_comparison_level::syntax_based);
+  auto handles = pool.insert(batch);
+  ASSERT_EQ(2u, handles.size());
+  EXPECT_EQ(handles[0], handles[1]);
+  EXPECT_EQ("http://www.example.com/b", pool[handles[0]].view());
+}
+
+TEST(uri_pool_test, move) {
+  network::uri_pool pool;
+  auto handle = pool.insert(full_uri);
+  auto view = pool[handle];
+  network::uri_pool moved(std::move(pool));
+  EXPECT_EQ(1u, moved.size());
+  EXPECT_EQ(view.view().data(), moved[handle].view().data());
+  EXPECT_EQ(handle, moved.insert(full_uri));
+}
+
+TEST(uri_pool_test, clear) {
+  network::uri_pool pool(network::uri_comparison_level::syntax_based);
+  pool.insert(full_uri);
+  EXPECT_NE(0u, pool.allocated_bytes());
+  pool.clear();
+  EXPECT_TRUE(pool.empty());
+  EXPECT_EQ(0u, pool.allocated_bytes());
+  EXPECT_EQ(network::uri_comparison_level::syntax_based, pool.level());
+  EXPECT_EQ(0u, pool.insert(full_uri));
+}
+
+TEST(uri_pool_test, reserve) {
+  network::uri_pool pool;
+  pool.reserve(1000);
+  auto reserved = pool.allocated_bytes();
+  for (int i = 0; i < 1000; ++i) {
+    pool.insert("http://www.example.com/" + std::to_string(i));
+  }
+  // the index hasn't grown, only the slabs
+  EXPECT_LT(pool.allocated_bytes(),
+            reserved + network::uri_pool::default_slab_size + 64);
+}
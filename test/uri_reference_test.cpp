@@ -3,6 +3,7 @@
 // (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <string>
 #include <gtest/gtest.h>
 #include <network/uri.hpp>
 
@@ -66,3 +67,31 @@ TEST(uri_make_relative_test, make_relative_with_percent_encoding_normalization_w
   network::uri uri_2("http://www.example.com/%7E%66%6F%6F%62%61%72%5F%36%39/#fragment");
   ASSERT_EQ("/~foobar_69/#fragment", uri_1.make_relative(uri_2));
 }
+
+TEST(uri_make_relative_test, make_relative_with_dot_segments) {
+  network::uri uri_1("http://www.example.com/");
+  network::uri uri_2("http://www.example.com/a//./b/../c/.");
+  ASSERT_EQ("/a/c", uri_1.make_relative(uri_2));
+}
+
+TEST(uri_make_relative_test, make_relative_with_a_deep_path) {
+  std::string path, expected;
+  for (int i = 0; i < 40; ++i) {
+    path += "/s" + std::to_string(i);
+    if (i < 35) {
+      expected += "/s" + std::to_string(i);
+    }
+  }
+  path += "/../../../../../x/";
+  expected += "/x/";
+
+  network::uri uri_1("http://www.example.com/");
+  network::uri uri_2("http://www.example.com" + path);
+  ASSERT_EQ(expected, uri_1.make_relative(uri_2).string());
+}
+
+TEST(uri_make_relative_test, make_relative_above_root) {
+  network::uri uri_1("http://www.example.com/");
+  network::uri uri_2("http://www.example.com/a/../../b");
+  ASSERT_THROW(uri_1.make_relative(uri_2), network::uri_builder_error);
+}
@@ -0,0 +1,89 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstdlib>
+#include <string>
+#include <system_error>
+#include <gtest/gtest.h>
+#include <network/uri.hpp>
+#include "string_utility.hpp"
+
+namespace {
+bool is_gopher_registered = false;
+
+// Finds a registered scheme while the program exits, after anything
+// that was created after it has been destroyed.
+struct find_at_exit {
+  ~find_at_exit() {
+    const auto port = network::find_default_port("gopher");
+    if (is_gopher_registered && (!port || (port->compare("70") != 0))) {
+      std::abort();
+    }
+  }
+} find_at_exit_instance;
+}  // namespace
+
+TEST(uri_schemes_test, builtin_default_ports) {
+  EXPECT_EQ("80", *network::find_default_port("http"));
+  EXPECT_EQ("443", *network::find_default_port("https"));
+  EXPECT_EQ("80", *network::find_default_port("ws"));
+  EXPECT_EQ("443", *network::find_default_port("wss"));
+  EXPECT_EQ("21", *network::find_default_port("ftp"));
+}
+
+TEST(uri_schemes_test, scheme_is_compared_without_regard_to_case) {
+  EXPECT_EQ("443", *network::find_default_port("HTTPS"));
+  EXPECT_EQ("21", *network::find_default_port("Ftp"));
+}
+
+TEST(uri_schemes_test, unknown_scheme) {
+  EXPECT_FALSE(network::find_default_port(""));
+  EXPECT_FALSE(network::find_default_port("htt"));
+  EXPECT_FALSE(network::find_default_port("httpss"));
+  EXPECT_FALSE(network::find_default_port("wsx"));
+  EXPECT_FALSE(network::find_default_port("gopher-unknown"));
+}
+
+TEST(uri_schemes_test, register_scheme) {
+  EXPECT_FALSE(network::find_default_port("gopher"));
+  network::register_uri_scheme("Gopher", "070");
+  is_gopher_registered = true;
+  EXPECT_EQ("70", *network::find_default_port("gopher"));
+  EXPECT_EQ("70", *network::find_default_port("GOPHER"));
+
+  network::uri instance("gopher://www.example.com:70/");
+  EXPECT_EQ("gopher://www.example.com/",
+            instance.normalize(network::uri_comparison_level::scheme_based)
+                .string());
+}
+
+TEST(uri_schemes_test, register_scheme_again) {
+  network::register_uri_scheme("nntp", "119");
+  network::register_uri_scheme("telnet", "23");
+  network::register_uri_scheme("nntp", "1119");
+  EXPECT_EQ("1119", *network::find_default_port("nntp"));
+  EXPECT_EQ("23", *network::find_default_port("telnet"));
+}
+
+TEST(uri_schemes_test, register_a_builtin_scheme) {
+  network::register_uri_scheme("ftp", "2121");
+  EXPECT_EQ("2121", *network::find_default_port("ftp"));
+
+  network::uri instance("ftp://ftp.example.com:21/");
+  EXPECT_EQ("ftp://ftp.example.com:21/",
+            instance.normalize(network::uri_comparison_level::scheme_based)
+                .string());
+}
+
+TEST(uri_schemes_test, register_an_invalid_scheme) {
+  EXPECT_THROW(network::register_uri_scheme("", "80"), std::system_error);
+  EXPECT_THROW(network::register_uri_scheme("1http", "80"), std::system_error);
+  EXPECT_THROW(network::register_uri_scheme("ht tp", "80"), std::system_error);
+}
+
+TEST(uri_schemes_test, register_an_invalid_port) {
+  EXPECT_THROW(network::register_uri_scheme("gopher", ""), std::system_error);
+  EXPECT_THROW(network::register_uri_scheme("gopher", "7a"), std::system_error);
+}
@@ -14,6 +14,22 @@
 #include <unordered_set>
 #include "string_utility.hpp"
 
+namespace {
+// These are constructed before main, maybe before the library's own
+// globals are initialized.
+const network::uri static_uri("ftp://files.example.com/pub");
+const network::uri static_web_uri("https://www.example.com:8080/");
+}  // namespace
+
+TEST(uri_test, construct_uri_during_static_initialization) {
+  EXPECT_EQ("ftp", static_uri.scheme());
+  EXPECT_EQ("files.example.com", static_uri.host());
+  EXPECT_EQ("/pub", static_uri.path());
+  EXPECT_EQ("https", static_web_uri.scheme());
+  EXPECT_EQ("www.example.com", static_web_uri.host());
+  EXPECT_EQ("8080", static_web_uri.port());
+}
+
 TEST(uri_test, construct_invalid_uri) {
   EXPECT_THROW(network::uri("I am not a valid URI."), network::uri_syntax_error);
 }
@@ -495,6 +511,59 @@ TEST(uri_test, uri_unordered_set_test) {
   EXPECT_EQ(network::uri("http://www.example.com/"), (*std::begin(uri_set)));
 }
 
+TEST(uri_test, hash_is_computed_when_the_uri_is_constructed) {
+  network::uri instance("http://www.example.com/");
+  EXPECT_EQ(network::detail::hash_string(instance.view()), instance.hash());
+  EXPECT_EQ(instance.hash(), std::hash<network::uri>()(instance));
+  EXPECT_EQ(network::uri("  http://www.example.com/ ").hash(), instance.hash());
+  EXPECT_EQ(network::uri(network::uri_view(instance.view())).hash(),
+            instance.hash());
+  EXPECT_EQ(network::uri_builder()
+                .scheme("http")
+                .host("www.example.com")
+                .path("/")
+                .uri()
+                .hash(),
+            instance.hash());
+}
+
+TEST(uri_test, hash_follows_the_string) {
+  network::uri instance("http://www.example.com/"), other("http://b/");
+  const auto hash = instance.hash(), other_hash = other.hash();
+  EXPECT_NE(hash, other_hash);
+
+  auto copy = instance;
+  EXPECT_EQ(hash, copy.hash());
+  copy.swap(other);
+  EXPECT_EQ(other_hash, copy.hash());
+  EXPECT_EQ(hash, other.hash());
+
+  auto moved = std::move(other);
+  EXPECT_EQ(hash, moved.hash());
+  EXPECT_EQ(network::uri().hash(), other.hash());
+
+  copy = instance;
+  EXPECT_EQ(hash, copy.hash());
+}
+
+TEST(uri_test, hash_of_similar_uris) {
+  std::unordered_set<std::size_t> hashes;
+  std::string url("http://www.example.com/");
+  // every length reads the string differently
+  for (int i = 0; i < 200; ++i) {
+    url.push_back('a');
+    hashes.insert(network::uri(url).hash());
+    hashes.insert(network::uri(url + "?" + std::to_string(i)).hash());
+  }
+  EXPECT_EQ(400u, hashes.size());
+  EXPECT_NE(network::detail::hash_string("ab"),
+            network::detail::hash_string("ba"));
+  EXPECT_NE(network::detail::hash_string("abc"),
+            network::detail::hash_string("abd"));
+  EXPECT_NE(network::detail::hash_string(""),
+            network::detail::hash_string(network::string_view("\0", 1)));
+}
+
 TEST(uri_test, empty_uri) {
   network::uri instance;
   EXPECT_TRUE(instance.empty());
@@ -708,6 +777,67 @@ TEST(uri_test, full_move_uri_fragment_test) {
   EXPECT_EQ("fragment", instance.fragment());
 }
 
+TEST(uri_test, moved_from_uri_is_empty) {
+  network::uri origin("http://user@www.example.com:80/path?query#fragment");
+  network::uri instance = std::move(origin);
+  EXPECT_TRUE(origin.empty());
+  EXPECT_FALSE(origin.has_scheme());
+  EXPECT_FALSE(origin.has_host());
+  EXPECT_FALSE(origin.has_path());
+}
+
+TEST(uri_test, copy_outlives_original) {
+  std::unique_ptr<network::uri> origin(
+      new network::uri("http://user@www.example.com:80/path?query#fragment"));
+  network::uri instance = *origin;
+  origin.reset();
+  EXPECT_EQ("http", instance.scheme());
+  EXPECT_EQ("user", instance.user_info());
+  EXPECT_EQ("www.example.com", instance.host());
+  EXPECT_EQ("80", instance.port());
+  EXPECT_EQ("/path", instance.path());
+  EXPECT_EQ("query", instance.query());
+  EXPECT_EQ("fragment", instance.fragment());
+}
+
+TEST(uri_test, construct_from_rvalue_string_adopts_its_buffer) {
+  std::string source("http://www.example.com/path?query#fragment");
+  const auto data = source.data();
+  network::uri instance(std::move(source));
+  EXPECT_EQ(data, instance.view().data());
+  EXPECT_EQ("www.example.com", instance.host());
+}
+
+TEST(uri_test, construct_from_rvalue_string_with_whitespace) {
+  std::string source("  http://www.example.com/path?query#fragment \r\n");
+  const auto data = source.data();
+  network::uri instance(std::move(source));
+  EXPECT_EQ("http://www.example.com/path?query#fragment", instance.string());
+  EXPECT_EQ(data, instance.view().data());
+  EXPECT_EQ("query", instance.query());
+}
+
+TEST(uri_test, construct_invalid_rvalue_string) {
+  EXPECT_THROW(network::uri(std::string("http://a.com/pa th")),
+               network::uri_syntax_error);
+
+  std::error_code ec;
+  network::uri instance(std::string("http://a.com/pa th"), ec);
+  EXPECT_TRUE(ec);
+}
+
+TEST(uri_test, construct_from_string_view) {
+  std::string buffer("  http://www.example.com/path  ");
+  network::string_view source(buffer);
+  network::uri instance(source.substr(2, 27));
+  EXPECT_EQ("http://www.example.com/path", instance.string());
+  EXPECT_NE(buffer.data() + 2, instance.view().data());
+
+  std::error_code ec;
+  network::uri other(network::string_view("http://a.com/pa th"), ec);
+  EXPECT_TRUE(ec);
+}
+
 TEST(uri_test, mailto_uri_path) {
   network::uri origin("mailto:john.doe@example.com?query#fragment");
   network::uri instance = origin;
@@ -1069,3 +1199,26 @@ TEST(uri_test, assignment_operator_bug_116) {
   a = b;
   ASSERT_FALSE(a.has_port()) << a.string() << ", " << a.port();
 }
+
+TEST(uri_test, incremental_hash_is_the_same_as_hash_bytes) {
+  std::string source;
+  for (std::size_t i = 0; i < 200; ++i) {
+    source.push_back(static_cast<char>('a' + (i * 7) % 26));
+  }
+
+  for (std::size_t size = 0; size <= source.size(); ++size) {
+    const auto expected = network::detail::hash_bytes(source.data(), size);
+
+    network::detail::incremental_hash by_char;
+    for (std::size_t i = 0; i < size; ++i) {
+      by_char.append(source[i]);
+    }
+    EXPECT_EQ(expected, by_char.finish()) << size;
+
+    network::detail::incremental_hash by_piece;
+    for (std::size_t i = 0, piece = 1; i < size; i += piece, ++piece) {
+      by_piece.append(source.data() + i, std::min(piece, size - i));
+    }
+    EXPECT_EQ(expected, by_piece.finish()) << size;
+  }
+}
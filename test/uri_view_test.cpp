@@ -0,0 +1,178 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <gtest/gtest.h>
+#include <network/uri.hpp>
+#include <string>
+#include "string_utility.hpp"
+
+TEST(uri_view_test, construct_invalid_uri_view) {
+  EXPECT_THROW(network::uri_view("I am not a valid URI."),
+               network::uri_syntax_error);
+}
+
+TEST(uri_view_test, construct_invalid_uri_view_with_error_code) {
+  std::error_code ec;
+  network::uri_view instance("I am not a valid URI.", ec);
+  EXPECT_TRUE(static_cast<bool>(ec));
+}
+
+TEST(uri_view_test, construct_valid_uri_view_with_error_code) {
+  std::error_code ec;
+  network::uri_view instance("http://www.example.com/", ec);
+  EXPECT_FALSE(ec);
+}
+
+TEST(uri_view_test, default_constructed_uri_view_is_empty) {
+  network::uri_view instance;
+  EXPECT_TRUE(instance.empty());
+  EXPECT_FALSE(instance.has_scheme());
+  EXPECT_FALSE(instance.has_path());
+}
+
+TEST(uri_view_test, full_uri_view) {
+  network::uri_view instance(
+      "http://user@www.example.com:80/path?query#fragment");
+  EXPECT_EQ("http", instance.scheme());
+  EXPECT_EQ("user", instance.user_info());
+  EXPECT_EQ("www.example.com", instance.host());
+  EXPECT_EQ("80", instance.port());
+  EXPECT_EQ("/path", instance.path());
+  EXPECT_EQ("query", instance.query());
+  EXPECT_EQ("fragment", instance.fragment());
+  EXPECT_EQ("user@www.example.com:80", instance.authority());
+  EXPECT_TRUE(instance.is_absolute());
+  EXPECT_FALSE(instance.is_opaque());
+}
+
+TEST(uri_view_test, opaque_uri_view) {
+  network::uri_view instance("mailto:john.doe@example.com");
+  EXPECT_EQ("mailto", instance.scheme());
+  EXPECT_FALSE(instance.has_host());
+  EXPECT_EQ("john.doe@example.com", instance.path());
+  EXPECT_TRUE(instance.is_opaque());
+}
+
+TEST(uri_view_test, file_uri_view) {
+  network::uri_view instance("file:///path/to/file.txt?a=b");
+  ASSERT_TRUE(instance.has_host());
+  EXPECT_EQ("", instance.host());
+  EXPECT_EQ("/path/to/file.txt", instance.path());
+  EXPECT_EQ("a=b", instance.query());
+}
+
+TEST(uri_view_test, uri_view_refers_to_the_source) {
+  std::string source("http://www.example.com/path");
+  network::uri_view instance(source);
+  EXPECT_EQ(source.data(), instance.view().data());
+  EXPECT_EQ(source.data() + 7, instance.host().data());
+  EXPECT_EQ(source.data() + 22, instance.path().data());
+}
+
+TEST(uri_view_test, uri_view_ignores_whitespace) {
+  std::string source("  http://www.example.com/  ");
+  network::uri_view instance(source);
+  EXPECT_EQ("http://www.example.com/", instance.view());
+  EXPECT_EQ("www.example.com", instance.host());
+  EXPECT_EQ("/", instance.path());
+}
+
+TEST(uri_view_test, uri_view_of_part_of_a_buffer) {
+  std::string request("GET http://www.example.com/path HTTP/1.1");
+  network::uri_view instance(network::string_view(request).substr(4, 27));
+  EXPECT_EQ("http://www.example.com/path", instance.view());
+  EXPECT_EQ("/path", instance.path());
+}
+
+TEST(uri_view_test, query_iterator_with_two_kvps) {
+  network::uri_view instance("http://example.com/?a=b&c=d");
+  auto query_it = instance.query_begin();
+  ASSERT_NE(query_it, instance.query_end());
+  EXPECT_EQ("a", query_it->first);
+  EXPECT_EQ("b", query_it->second);
+  ++query_it;
+  ASSERT_NE(query_it, instance.query_end());
+  EXPECT_EQ("c", query_it->first);
+  EXPECT_EQ("d", query_it->second);
+  ++query_it;
+  EXPECT_EQ(query_it, instance.query_end());
+}
+
+TEST(uri_view_test, query_iterator_with_no_query) {
+  network::uri_view instance("http://example.com/");
+  EXPECT_EQ(instance.query_begin(), instance.query_end());
+}
+
+TEST(uri_view_test, convert_to_uri) {
+  std::string source("http://user@www.example.com:80/path?query#fragment");
+  network::uri_view view(source);
+  network::uri instance(view);
+  source.assign(source.size(), 'x');
+  EXPECT_EQ("http", instance.scheme());
+  EXPECT_EQ("user", instance.user_info());
+  EXPECT_EQ("www.example.com", instance.host());
+  EXPECT_EQ("80", instance.port());
+  EXPECT_EQ("/path", instance.path());
+  EXPECT_EQ("query", instance.query());
+  EXPECT_EQ("fragment", instance.fragment());
+}
+
+TEST(uri_view_test, converted_uri_is_equal_to_parsed_uri) {
+  network::uri_view view("  http://www.example.com/path?a=b  ");
+  EXPECT_EQ(network::uri("http://www.example.com/path?a=b"),
+            network::uri(view));
+}
+
+TEST(uri_view_test, equality_test) {
+  std::string lhs("http://www.example.com/"), rhs("http://www.example.com/");
+  EXPECT_EQ(network::uri_view(lhs), network::uri_view(rhs));
+  EXPECT_NE(network::uri_view(lhs), network::uri_view("http://example.com/"));
+}
+
+TEST(uri_view_test, literal) {
+  using namespace network::uri_literals;
+  auto instance = "https://user@www.example.com:8080/path?query#fragment"_uri;
+  EXPECT_EQ("https", instance.scheme());
+  EXPECT_EQ("user", instance.user_info());
+  EXPECT_EQ("www.example.com", instance.host());
+  EXPECT_EQ("8080", instance.port());
+  EXPECT_EQ("/path", instance.path());
+  EXPECT_EQ("query", instance.query());
+  EXPECT_EQ("fragment", instance.fragment());
+}
+
+TEST(uri_view_test, literal_is_the_same_as_the_constructor) {
+  using namespace network::uri_literals;
+  EXPECT_EQ(network::uri_view("mailto:john.doe@example.com"),
+            "mailto:john.doe@example.com"_uri);
+  EXPECT_EQ(network::uri_view("http://[::1]:8080/").host(),
+            "http://[::1]:8080/"_uri.host());
+}
+
+TEST(uri_view_test, invalid_literal) {
+  using namespace network::uri_literals;
+  EXPECT_THROW("http://www.example.com/pa th"_uri, network::uri_syntax_error);
+  EXPECT_THROW(""_uri, network::uri_syntax_error);
+}
+
+#if defined(NETWORK_URI_HAS_CXX14_CONSTEXPR)
+TEST(uri_view_test, constexpr_literal) {
+  using namespace network::uri_literals;
+  constexpr auto instance = "https://api.example.com/v1/users?page=2"_uri;
+  static_assert(instance.has_host() && !instance.has_port(), "");
+  static_assert(instance.host().size() == 15, "");
+  static_assert(instance.path()[1] == 'v', "");
+  EXPECT_EQ("api.example.com", instance.host());
+  EXPECT_EQ("/v1/users", instance.path());
+  EXPECT_EQ("page=2", instance.query());
+  EXPECT_FALSE(instance.has_port());
+}
+#endif  // defined(NETWORK_URI_HAS_CXX14_CONSTEXPR)
+
+TEST(uri_view_test, hash_is_the_same_as_the_uri) {
+  network::uri_view instance("http://www.example.com/path?query");
+  EXPECT_EQ(network::uri(instance).hash(),
+            std::hash<network::uri_view>()(instance));
+}